@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+// (a + b) * c - a with one Tensor op per step.
+static void UnfusedEWCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{state.range(0)};
+    Tensor a = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor b = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor c = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = (a + b) * c - a;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = (a + b) * c - a;
+    }
+}
+
+// (a + b) * c - a in a single pass with kernel::FusedEW.
+static void FusedEWCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{state.range(0)};
+    Tensor a = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor b = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor c = Tensor::Ones(shape, Dtype::Float32, device);
+
+    kernel::FusedEW fused;
+    int64_t a_id = fused.Input(a);
+    int64_t sum = fused.Binary(kernel::BinaryEWOpCode::Add, a_id,
+                               fused.Input(b));
+    int64_t mul =
+            fused.Binary(kernel::BinaryEWOpCode::Mul, sum, fused.Input(c));
+    int64_t result = fused.Binary(kernel::BinaryEWOpCode::Sub, mul, a_id);
+    Tensor warm_up = fused.Run(result);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = fused.Run(result);
+    }
+}
+
+BENCHMARK(UnfusedEWCPU)
+        ->Arg(1 << 20)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(FusedEWCPU)
+        ->Arg(1 << 20)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+// (N, 3) points transformed by a 3x3 rotation.
+static void MatmulPointsCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor points = Tensor::Ones({state.range(0), 3}, Dtype::Float32, device);
+    Tensor rotation = Tensor::Ones({3, 3}, Dtype::Float32, device);
+    Tensor warm_up = points.Matmul(rotation);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = points.Matmul(rotation);
+    }
+}
+
+// (N, N) square matrix product.
+static void MatmulSquareCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{state.range(0), state.range(0)};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = lhs.Matmul(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Matmul(rhs);
+    }
+}
+
+// Batch of (6, 6) products, e.g. per-correspondence normal equations.
+static void BatchMatmulCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{state.range(0), 6, 6};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float64, device);
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float64, device);
+    Tensor warm_up = lhs.BatchMatmul(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.BatchMatmul(rhs);
+    }
+}
+
+BENCHMARK(MatmulPointsCPU)
+        ->Arg(1 << 20)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(MatmulSquareCPU)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BatchMatmulCPU)
+        ->Arg(10000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
@@ -47,10 +47,41 @@ static void ReductionCPU(benchmark::State& state) {
     }
 }
 
+// Column sums of a (N, 3) tensor, e.g. point cloud centroids.
+static void ReductionColumnSumCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({state.range(0), 3}, Dtype::Float32, device);
+    Tensor warm_up = src.Sum({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({0});
+    }
+}
+
+// Means of a (N, 33) tensor, e.g. FPFH features.
+static void ReductionFeatureMeanCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    int64_t num_rows = state.range(0);
+    Tensor src = Tensor::Ones({num_rows, 33}, Dtype::Float64, device);
+    Tensor warm_up = src.Sum({0}) / static_cast<double>(num_rows);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({0}) / static_cast<double>(num_rows);
+    }
+}
+
 // Fixture does play very well with static initialization in Open3D. Use the
 // simple BENCHMARK here.
 // https://github.com/google/benchmark/issues/498
 BENCHMARK(ReductionCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionColumnSumCPU)
+        ->Arg(1 << 20)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionFeatureMeanCPU)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
 
 #ifdef BUILD_CUDA_MODULE
 
@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+// Contiguous operands take the fast path in CPULauncher.
+static void UnaryEWContiguousCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{state.range(0)};
+    Tensor src = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+}
+
+// Transposed operand takes the generic Indexer path in CPULauncher.
+static void UnaryEWNonContiguousCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{state.range(0) / 1000, 1000};
+    Tensor src = Tensor::Ones(shape, Dtype::Float32, device).T();
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+}
+
+BENCHMARK(UnaryEWContiguousCPU)
+        ->Arg(1 << 20)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(UnaryEWNonContiguousCPU)
+        ->Arg(1 << 20)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
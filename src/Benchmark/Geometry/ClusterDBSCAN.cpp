@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class ClusterDBSCANFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Gaussian blobs of points around random centers in a unit cube.
+        const size_t num_points = size_t(state.range(0));
+        if (pc_.points_.size() == num_points) return;
+        pc_.Clear();
+        pc_.points_.resize(num_points);
+        std::vector<Eigen::Vector3d> centers(64);
+        for (auto& center : centers) {
+            center = (Eigen::Vector3d::Random() + Eigen::Vector3d::Ones()) *
+                     0.5;
+        }
+        for (size_t i = 0; i < num_points; i++) {
+            pc_.points_[i] = centers[i % centers.size()] +
+                             Eigen::Vector3d::Random() * 0.05;
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud pc_;
+};
+
+BENCHMARK_DEFINE_F(ClusterDBSCANFixture, ClusterDBSCAN)
+(benchmark::State& state) {
+    const double eps = double(state.range(1)) / 1000.0;
+    for (auto _ : state) {
+        pc_.ClusterDBSCAN(eps, 10);
+    }
+}
+
+// Points, eps in units of 1e-3. The sparse neighborhoods of the smaller eps
+// are searched in a KDTree, the denser ones on a grid.
+BENCHMARK_REGISTER_F(ClusterDBSCANFixture, ClusterDBSCAN)
+        ->Args({1 << 18, 5})
+        ->Args({1 << 18, 10})
+        ->Args({1 << 18, 20})
+        ->Args({1 << 14, 80})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class EstimateNormalsFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // A 640 x 480 depth frame of a wavy surface, projected with a point
+        // for every pixel.
+        if (pc_organized_) return;
+        geometry::Image depth;
+        depth.Prepare(640, 480, 1, 4);
+        for (int v = 0; v < 480; v++) {
+            for (int u = 0; u < 640; u++) {
+                *depth.PointerAt<float>(u, v) =
+                        float(1.5 + 0.1 * std::sin(u * 0.05) *
+                                            std::cos(v * 0.05));
+            }
+        }
+        camera::PinholeCameraIntrinsic intrinsic(
+                camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+        pc_organized_ = geometry::PointCloud::CreateFromDepthImage(
+                depth, intrinsic, Eigen::Matrix4d::Identity(), 1000.0, 1000.0,
+                1, false);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pc_organized_;
+};
+
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, EstimateNormalsKNN)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pc_organized_->normals_.clear();
+        pc_organized_->EstimateNormals(geometry::KDTreeSearchParamKNN(25));
+    }
+}
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, EstimateNormalsKNN)
+        ->Unit(benchmark::kMillisecond);
+
+// The same 5 x 5 pixel neighborhoods as the 25 nearest neighbors above.
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, EstimateNormalsOrganized)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pc_organized_->normals_.clear();
+        pc_organized_->EstimateNormalsOrganized(2, 0.05);
+    }
+}
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, EstimateNormalsOrganized)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, RemoveRadiusOutliersOrganized)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pc_organized_->RemoveRadiusOutliersOrganized(8, 0.02, 2);
+    }
+}
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, RemoveRadiusOutliersOrganized)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(EstimateNormalsFixture, DownSampleOrganized)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pc_organized_->DownSampleOrganized(4);
+    }
+}
+
+BENCHMARK_REGISTER_F(EstimateNormalsFixture, DownSampleOrganized)
+        ->Unit(benchmark::kMillisecond);
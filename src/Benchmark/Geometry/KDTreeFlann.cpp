@@ -94,3 +94,95 @@ BENCHMARK(BM_TestKDTreeLine0)->Args({1 << 5, 1 << 10})->Args({1 << 9, 1 << 11});
 BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
+
+class KDTreeFlannBatchFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Uniform random points in a unit cube, queried at every point.
+        const size_t num_points = size_t(state.range(0));
+        if (pc_.points_.size() == num_points) return;
+        pc_.Clear();
+        pc_.points_.resize(num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            pc_.points_[i] = (Vector3d::Random() + Vector3d::Ones()) * 0.5;
+        }
+        kdtree_.SetGeometry(pc_);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    Map<const MatrixXd> Queries() const {
+        return Map<const MatrixXd>((const double*)pc_.points_.data(), 3,
+                                   pc_.points_.size());
+    }
+    geometry::PointCloud pc_;
+    geometry::KDTreeFlann kdtree_;
+};
+
+BENCHMARK_DEFINE_F(KDTreeFlannBatchFixture, SearchKNN)
+(benchmark::State& state) {
+    const int knn = int(state.range(1));
+    for (auto _ : state) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(pc_.points_.size()); i++) {
+            vector<int> indices;
+            vector<double> distance2;
+            kdtree_.SearchKNN(pc_.points_[i], knn, indices, distance2);
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(KDTreeFlannBatchFixture, SearchKNNBatch)
+(benchmark::State& state) {
+    const int knn = int(state.range(1));
+    vector<int> indices;
+    vector<double> distance2;
+    for (auto _ : state) {
+        kdtree_.SearchKNNBatch(Queries(), knn, indices, distance2);
+    }
+}
+
+BENCHMARK_DEFINE_F(KDTreeFlannBatchFixture, SearchRadius)
+(benchmark::State& state) {
+    const double radius = double(state.range(1)) / 1000.0;
+    for (auto _ : state) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(pc_.points_.size()); i++) {
+            vector<int> indices;
+            vector<double> distance2;
+            kdtree_.SearchRadius(pc_.points_[i], radius, indices, distance2);
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(KDTreeFlannBatchFixture, SearchRadiusBatch)
+(benchmark::State& state) {
+    const double radius = double(state.range(1)) / 1000.0;
+    vector<int> indices;
+    vector<double> distance2;
+    vector<size_t> offsets;
+    for (auto _ : state) {
+        kdtree_.SearchRadiusBatch(Queries(), radius, indices, distance2,
+                                  offsets);
+    }
+}
+
+// Points, knn.
+BENCHMARK_REGISTER_F(KDTreeFlannBatchFixture, SearchKNN)
+        ->Args({1 << 18, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(KDTreeFlannBatchFixture, SearchKNNBatch)
+        ->Args({1 << 18, 30})
+        ->Unit(benchmark::kMillisecond);
+// Points, radius in units of 1e-3.
+BENCHMARK_REGISTER_F(KDTreeFlannBatchFixture, SearchRadius)
+        ->Args({1 << 18, 20})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(KDTreeFlannBatchFixture, SearchRadiusBatch)
+        ->Args({1 << 18, 20})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class RemoveOutliersFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Uniform random points in a unit cube.
+        const size_t num_points = size_t(state.range(0));
+        if (pc_.points_.size() == num_points) return;
+        pc_.Clear();
+        pc_.points_.resize(num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            pc_.points_[i] =
+                    (Eigen::Vector3d::Random() + Eigen::Vector3d::Ones()) *
+                    0.5;
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud pc_;
+};
+
+BENCHMARK_DEFINE_F(RemoveOutliersFixture, RemoveRadiusOutliers)
+(benchmark::State& state) {
+    const double radius = double(state.range(1)) / 1000.0;
+    for (auto _ : state) {
+        pc_.RemoveRadiusOutliers(16, radius);
+    }
+}
+
+// Points, radius in units of 1e-3. The larger radius holds hundreds of
+// neighbors per point, of which only the first 17 are counted.
+BENCHMARK_REGISTER_F(RemoveOutliersFixture, RemoveRadiusOutliers)
+        ->Args({1 << 17, 20})
+        ->Args({1 << 17, 50})
+        ->Unit(benchmark::kMillisecond);
+
+// The same neighbor counts from full radius searches, for comparison.
+BENCHMARK_DEFINE_F(RemoveOutliersFixture, SearchRadiusCount)
+(benchmark::State& state) {
+    const double radius = double(state.range(1)) / 1000.0;
+    geometry::KDTreeFlann kdtree(pc_);
+    for (auto _ : state) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        size_t count = 0;
+        for (const auto& point : pc_.points_) {
+            count += kdtree.SearchRadius(point, radius, indices, distance2) >
+                     16;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+BENCHMARK_REGISTER_F(RemoveOutliersFixture, SearchRadiusCount)
+        ->Args({1 << 17, 20})
+        ->Args({1 << 17, 50})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RemoveOutliersFixture, RemoveStatisticalOutliers)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pc_.RemoveStatisticalOutliers(int(state.range(1)), 2.0);
+    }
+}
+
+// Points, neighbors.
+BENCHMARK_REGISTER_F(RemoveOutliersFixture, RemoveStatisticalOutliers)
+        ->Args({1 << 17, 20})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class SegmentPlaneFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Half of the points on the plane z = 0, the others uniform random
+        // in a unit cube.
+        const size_t num_points = size_t(state.range(0));
+        if (pc_.points_.size() == num_points) return;
+        pc_.Clear();
+        pc_.points_.resize(num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            pc_.points_[i] = Eigen::Vector3d::Random();
+            if (i % 2 == 0) pc_.points_[i](2) = 0.0;
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud pc_;
+};
+
+BENCHMARK_DEFINE_F(SegmentPlaneFixture, SegmentPlane)
+(benchmark::State& state) {
+    const double probability = state.range(1) ? 0.99999999 : 1.0;
+    const int num_scoring_points = int(state.range(2));
+    for (auto _ : state) {
+        pc_.SegmentPlane(0.01, 3, 1000, probability, num_scoring_points);
+    }
+}
+
+// Points, adaptive iteration count, number of scoring points.
+BENCHMARK_REGISTER_F(SegmentPlaneFixture, SegmentPlane)
+        ->Args({1 << 20, 0, 0})
+        ->Args({1 << 20, 1, 0})
+        ->Args({1 << 20, 1, 1 << 14})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SegmentPlaneFixture, SegmentPlanes)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pc_.SegmentPlanes(int(state.range(1)), 0.01, 3, 1000);
+    }
+}
+
+// Points, planes.
+BENCHMARK_REGISTER_F(SegmentPlaneFixture, SegmentPlanes)
+        ->Args({1 << 20, 3})
+        ->Unit(benchmark::kMillisecond);
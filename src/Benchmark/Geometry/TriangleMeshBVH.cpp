@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class TriangleMeshBVHFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Spheres of 2 r (r - 1) triangles for a resolution r, one inside
+        // the other.
+        const int resolution = int(state.range(0));
+        if (mesh_ && resolution_ == resolution) return;
+        resolution_ = resolution;
+        mesh_ = geometry::TriangleMesh::CreateSphere(1.0, resolution);
+        inner_ = geometry::TriangleMesh::CreateSphere(0.9, resolution);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    int resolution_ = 0;
+    std::shared_ptr<geometry::TriangleMesh> mesh_;
+    std::shared_ptr<geometry::TriangleMesh> inner_;
+};
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, Build)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMeshBVH bvh(*mesh_);
+        benchmark::DoNotOptimize(bvh.GetNodes().data());
+    }
+}
+
+// Sphere resolution.
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, Build)
+        ->Args({100})
+        ->Args({500})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, GetSelfIntersectingTriangles)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh_->GetSelfIntersectingTriangles());
+    }
+}
+
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, GetSelfIntersectingTriangles)
+        ->Args({20})
+        ->Args({100})
+        ->Args({500})
+        ->Unit(benchmark::kMillisecond);
+
+// The test of every triangle pair, for comparison.
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, SelfIntersectingTrianglePairs)
+(benchmark::State& state) {
+    const auto& v = mesh_->vertices_;
+    const auto& triangles = mesh_->triangles_;
+    for (auto _ : state) {
+        size_t count = 0;
+        for (size_t i = 0; i < triangles.size(); i++) {
+            const Eigen::Vector3i& p = triangles[i];
+            for (size_t j = i + 1; j < triangles.size(); j++) {
+                const Eigen::Vector3i& q = triangles[j];
+                count += geometry::IntersectionTest::TriangleTriangle3d(
+                        v[p(0)], v[p(1)], v[p(2)], v[q(0)], v[q(1)], v[q(2)]);
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, SelfIntersectingTrianglePairs)
+        ->Args({20})
+        ->Args({100})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, IsIntersecting)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh_->IsIntersecting(*inner_));
+    }
+}
+
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, IsIntersecting)
+        ->Args({100})
+        ->Args({500})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, ClosestPoint)
+(benchmark::State& state) {
+    geometry::TriangleMeshBVH bvh(*mesh_);
+    for (auto _ : state) {
+        double distance = 0;
+        Eigen::Vector3d closest_point;
+        int triangle;
+        for (const auto& query : inner_->vertices_) {
+            distance += bvh.ClosestPoint(query, closest_point, triangle);
+        }
+        benchmark::DoNotOptimize(distance);
+    }
+}
+
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, ClosestPoint)
+        ->Args({100})
+        ->Args({500})
+        ->Unit(benchmark::kMillisecond);
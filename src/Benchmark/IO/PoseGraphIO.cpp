@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class PoseGraphIOFixture : public benchmark::Fixture {
+public:
+    ~PoseGraphIOFixture() {
+        for (const char* ext : {"json", "bin"}) {
+            std::remove(GetFileName(ext).c_str());
+        }
+    }
+
+    void SetUp(const benchmark::State& state) {
+        // A graph with 10 edges per node, written once in every format.
+        const int num_nodes = int(state.range(0));
+        if (int(pose_graph_.nodes_.size()) == num_nodes) return;
+        pose_graph_.nodes_.resize(num_nodes);
+        pose_graph_.edges_.clear();
+        for (int i = 0; i < num_nodes; i++) {
+            pose_graph_.nodes_[i].pose_.block<3, 1>(0, 3) =
+                    Eigen::Vector3d::Random();
+            for (int j = 1; j <= 10; j++) {
+                Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+                transformation.block<3, 1>(0, 3) = Eigen::Vector3d::Random();
+                pose_graph_.edges_.push_back(registration::PoseGraphEdge(
+                        i, (i + j) % num_nodes, transformation,
+                        Eigen::Matrix6d::Random(), j > 1));
+            }
+        }
+        for (const char* ext : {"json", "bin"}) {
+            io::WritePoseGraph(GetFileName(ext), pose_graph_);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    static std::string GetFileName(const std::string& ext) {
+        return std::string(TEST_DATA_DIR) + "/temp_pose_graph." + ext;
+    }
+
+    registration::PoseGraph pose_graph_;
+};
+
+BENCHMARK_DEFINE_F(PoseGraphIOFixture, ReadJSON)(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::PoseGraph pose_graph;
+        io::ReadPoseGraph(GetFileName("json"), pose_graph);
+    }
+}
+
+BENCHMARK_REGISTER_F(PoseGraphIOFixture, ReadJSON)
+        ->Arg(5000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PoseGraphIOFixture, ReadBIN)(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::PoseGraph pose_graph;
+        io::ReadPoseGraph(GetFileName("bin"), pose_graph);
+    }
+}
+
+BENCHMARK_REGISTER_F(PoseGraphIOFixture, ReadBIN)
+        ->Arg(5000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PoseGraphIOFixture, WriteBIN)(benchmark::State& state) {
+    for (auto _ : state) {
+        io::WritePoseGraph(GetFileName("bin"), pose_graph_);
+    }
+}
+
+BENCHMARK_REGISTER_F(PoseGraphIOFixture, WriteBIN)
+        ->Arg(5000)
+        ->Unit(benchmark::kMillisecond);
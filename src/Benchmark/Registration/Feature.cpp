@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/Feature.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class FeatureFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Uniform random points in a unit cube, with random normals.
+        const size_t num_points = size_t(state.range(0));
+        if (pc_.points_.size() == num_points) return;
+        pc_.Clear();
+        pc_.points_.resize(num_points);
+        pc_.normals_.resize(num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            pc_.points_[i] =
+                    (Eigen::Vector3d::Random() + Eigen::Vector3d::Ones()) *
+                    0.5;
+            pc_.normals_[i] = Eigen::Vector3d::Random().normalized();
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud pc_;
+};
+
+BENCHMARK_DEFINE_F(FeatureFixture, ComputeFPFHFeature)
+(benchmark::State& state) {
+    // About 100 points within the search radius.
+    const double radius = std::cbrt(75.0 / (M_PI * double(state.range(0))));
+    for (auto _ : state) {
+        registration::ComputeFPFHFeature(
+                pc_, geometry::KDTreeSearchParamHybrid(radius, 100));
+    }
+}
+
+// Points.
+BENCHMARK_REGISTER_F(FeatureFixture, ComputeFPFHFeature)
+        ->Arg(1 << 16)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
+#include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+namespace {
+
+/// A trajectory of keyframes along a helix, with noisy odometry edges and an
+/// edge to the keyframe two steps back.
+registration::PoseGraph CreateTrajectoryPoseGraph(int n_nodes) {
+    registration::PoseGraph pose_graph;
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 1000.0;
+    std::vector<Eigen::Matrix4d> ground_truth(n_nodes);
+    for (int i = 0; i < n_nodes; i++) {
+        double angle = 0.05 * i;
+        Eigen::Vector6d pose;
+        pose << 0.0, 0.0, angle, std::cos(angle), std::sin(angle), 0.01 * i;
+        ground_truth[i] = utility::TransformVector6dToMatrix4d(pose);
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(
+                i == 0 ? ground_truth[0]
+                       : Eigen::Matrix4d(pose_graph.nodes_.back().pose_)));
+        for (int j = std::max(0, i - 2); j < i; j++) {
+            Eigen::Vector6d noise = Eigen::Vector6d::Random() * 0.005;
+            Eigen::Matrix4d odometry =
+                    utility::TransformVector6dToMatrix4d(noise) *
+                    ground_truth[i].inverse() * ground_truth[j];
+            if (j == i - 1) {
+                pose_graph.nodes_[i].pose_ =
+                        pose_graph.nodes_[j].pose_ * odometry.inverse();
+            }
+            pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                    j, i, odometry, information, false));
+        }
+    }
+    return pose_graph;
+}
+
+}  // unnamed namespace
+
+class PoseGraphFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        const int num_nodes = int(state.range(0));
+        if (int(pose_graph_.nodes_.size()) == num_nodes) return;
+        pose_graph_ = CreateTrajectoryPoseGraph(num_nodes);
+        optimizer_ = registration::IncrementalPoseGraphOptimizer(
+                registration::GlobalOptimizationConvergenceCriteria(),
+                registration::GlobalOptimizationOption(), 10);
+        // Everything but the last keyframe is already optimized.
+        for (int i = 0; i + 1 < num_nodes; i++) {
+            optimizer_.AddNode(pose_graph_.nodes_[i]);
+            for (const auto& edge : pose_graph_.edges_) {
+                if (edge.target_node_id_ == i) optimizer_.AddEdge(edge);
+            }
+            optimizer_.Update();
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    registration::PoseGraph pose_graph_;
+    registration::IncrementalPoseGraphOptimizer optimizer_;
+};
+
+// Cost of adding one keyframe to a graph of the given size.
+BENCHMARK_DEFINE_F(PoseGraphFixture, IncrementalPoseGraphOptimizer)
+(benchmark::State& state) {
+    const int last = int(pose_graph_.nodes_.size()) - 1;
+    registration::IncrementalPoseGraphOptimizer optimizer;
+    for (auto _ : state) {
+        state.PauseTiming();
+        optimizer = optimizer_;
+        state.ResumeTiming();
+        optimizer.AddNode(pose_graph_.nodes_[last]);
+        for (const auto& edge : pose_graph_.edges_) {
+            if (edge.target_node_id_ == last) optimizer.AddEdge(edge);
+        }
+        optimizer.Update();
+    }
+}
+
+BENCHMARK_REGISTER_F(PoseGraphFixture, IncrementalPoseGraphOptimizer)
+        ->Arg(1000)
+        ->Arg(4000)
+        ->Unit(benchmark::kMillisecond);
+
+// The same keyframe optimized by a batch solve of the whole graph.
+BENCHMARK_DEFINE_F(PoseGraphFixture, GlobalOptimization)
+(benchmark::State& state) {
+    registration::GlobalOptimizationOption option(0.075, 0.25, 1.0, 0);
+    registration::PoseGraph pose_graph;
+    for (auto _ : state) {
+        state.PauseTiming();
+        pose_graph = optimizer_.GetPoseGraph();
+        pose_graph.nodes_.push_back(pose_graph_.nodes_.back());
+        for (const auto& edge : pose_graph_.edges_) {
+            if (edge.target_node_id_ == int(pose_graph.nodes_.size()) - 1) {
+                pose_graph.edges_.push_back(edge);
+            }
+        }
+        state.ResumeTiming();
+        registration::GlobalOptimization(
+                pose_graph, registration::GlobalOptimizationGaussNewton(),
+                registration::GlobalOptimizationConvergenceCriteria(), option);
+    }
+}
+
+BENCHMARK_REGISTER_F(PoseGraphFixture, GlobalOptimization)
+        ->Arg(1000)
+        ->Arg(4000)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/Registration.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+// The fragments and FPFH features of examples/Python/Benchmark, registered
+// with the parameters of benchmark_ransac.py.
+class RegistrationRANSACFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!source_.IsEmpty()) return;
+        io::ReadPointCloud(TEST_DATA_DIR "/Feature/cloud_bin_0.pcd", source_);
+        io::ReadPointCloud(TEST_DATA_DIR "/Feature/cloud_bin_1.pcd", target_);
+        io::ReadFeature(TEST_DATA_DIR "/Feature/cloud_bin_0.fpfh.bin",
+                        source_feature_);
+        io::ReadFeature(TEST_DATA_DIR "/Feature/cloud_bin_1.fpfh.bin",
+                        target_feature_);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    geometry::PointCloud source_;
+    geometry::PointCloud target_;
+    registration::Feature source_feature_;
+    registration::Feature target_feature_;
+};
+
+BENCHMARK_DEFINE_F(RegistrationRANSACFixture,
+                   RegistrationRANSACBasedOnFeatureMatching)
+(benchmark::State& state) {
+    const double distance_threshold = 0.075;
+    registration::CorrespondenceCheckerBasedOnEdgeLength checker_edge(0.9);
+    registration::CorrespondenceCheckerBasedOnDistance checker_distance(
+            distance_threshold);
+    for (auto _ : state) {
+        registration::RegistrationRANSACBasedOnFeatureMatching(
+                source_, target_, source_feature_, target_feature_,
+                distance_threshold,
+                registration::TransformationEstimationPointToPoint(false), 4,
+                {checker_edge, checker_distance},
+                registration::RANSACConvergenceCriteria(4000000,
+                                                        int(state.range(0))));
+    }
+}
+
+// Maximum number of validations.
+BENCHMARK_REGISTER_F(RegistrationRANSACFixture,
+                     RegistrationRANSACBasedOnFeatureMatching)
+        ->Arg(500)
+        ->Arg(5000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RegistrationRANSACFixture, FastGlobalRegistration)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::FastGlobalRegistration(source_, target_,
+                                             source_feature_, target_feature_);
+    }
+}
+
+BENCHMARK_REGISTER_F(RegistrationRANSACFixture, FastGlobalRegistration)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Eigen.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+// Point-to-plane normal equations of 1M correspondences between random points.
+class JTJandJTrFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        const int num_correspondences = 1 << 20;
+        if (int(corres_.size()) == num_correspondences) return;
+        source_.points_.resize(num_correspondences);
+        target_.points_.resize(num_correspondences);
+        target_.normals_.resize(num_correspondences);
+        corres_.resize(num_correspondences);
+        for (int i = 0; i < num_correspondences; i++) {
+            source_.points_[i] = Eigen::Vector3d::Random();
+            target_.points_[i] = Eigen::Vector3d::Random();
+            target_.normals_[i] = Eigen::Vector3d::Random().normalized();
+            corres_[i] = Eigen::Vector2i(i, num_correspondences - 1 - i);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    void ComputeJacobianAndResidual(int i, Eigen::Vector6d& J_r, double& r) {
+        const Eigen::Vector3d& vs = source_.points_[corres_[i][0]];
+        const Eigen::Vector3d& vt = target_.points_[corres_[i][1]];
+        const Eigen::Vector3d& nt = target_.normals_[corres_[i][1]];
+        r = (vs - vt).dot(nt);
+        J_r.block<3, 1>(0, 0) = vs.cross(nt);
+        J_r.block<3, 1>(3, 0) = nt;
+    }
+
+    geometry::PointCloud source_;
+    geometry::PointCloud target_;
+    registration::CorrespondenceSet corres_;
+};
+
+BENCHMARK_DEFINE_F(JTJandJTrFixture, ComputeJTJandJTr)
+(benchmark::State& state) {
+    auto f = [&](int i, Eigen::Vector6d& J_r, double& r) {
+        ComputeJacobianAndResidual(i, J_r, r);
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        f, int(corres_.size()), false));
+    }
+}
+
+BENCHMARK_DEFINE_F(JTJandJTrFixture, ComputeFusedJTJandJTr)
+(benchmark::State& state) {
+    auto f = [&](int i, Eigen::Vector6d* J_r, double* r) {
+        ComputeJacobianAndResidual(i, J_r[0], r[0]);
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                utility::ComputeFusedJTJandJTr(f, int(corres_.size())));
+    }
+}
+
+BENCHMARK_DEFINE_F(JTJandJTrFixture, PointToPlaneComputeTransformation)
+(benchmark::State& state) {
+    registration::TransformationEstimationPointToPlane estimation;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                estimation.ComputeTransformation(source_, target_, corres_));
+    }
+}
+
+BENCHMARK_REGISTER_F(JTJandJTrFixture, ComputeJTJandJTr)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(JTJandJTrFixture, ComputeFusedJTJandJTr)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(JTJandJTrFixture, PointToPlaneComputeTransformation)
+        ->Unit(benchmark::kMillisecond);
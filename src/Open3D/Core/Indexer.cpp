@@ -528,6 +528,25 @@ void Indexer::UpdateMasterStrides() {
     }
 }
 
+bool Indexer::IsContiguousRef(const TensorRef& tr) const {
+    for (int64_t i = 0; i < ndims_; ++i) {
+        if (master_shape_[i] > 1 &&
+            tr.byte_strides_[i] != master_strides_[i] * tr.dtype_byte_size_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Indexer::IsBroadcastScalarRef(const TensorRef& tr) const {
+    for (int64_t i = 0; i < ndims_; ++i) {
+        if (master_shape_[i] > 1 && tr.byte_strides_[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Indexer::BroadcastRestride(TensorRef& src,
                                 int64_t dst_ndims,
                                 const int64_t* dst_shape) {
@@ -346,6 +346,23 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns true if the \p input_idx -th input is laid out contiguously in
+    /// the iteration order of the Indexer, i.e. the i-th workload reads the
+    /// i-th element of the input buffer.
+    bool IsInputContiguous(int64_t input_idx) const {
+        return IsContiguousRef(GetInput(input_idx));
+    }
+
+    /// Returns true if the \p input_idx -th input is broadcasted from a single
+    /// element, i.e. all workloads read the same input element.
+    bool IsInputBroadcastScalar(int64_t input_idx) const {
+        return IsBroadcastScalarRef(GetInput(input_idx));
+    }
+
+    /// Returns true if the output is laid out contiguously in the iteration
+    /// order of the Indexer. Only works if there's only one output.
+    bool IsOutputContiguous() const { return IsContiguousRef(GetOutput()); }
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
@@ -428,6 +445,14 @@ protected:
                                   const int64_t* src_shape,
                                   const SizeVector& reduction_dims);
 
+    /// Returns true if \p tr 's byte strides are the default strides of
+    /// master_shape_. Dimensions of size 1 are ignored.
+    bool IsContiguousRef(const TensorRef& tr) const;
+
+    /// Returns true if \p tr 's byte strides are 0 in all non-trivial
+    /// dimensions of master_shape_.
+    bool IsBroadcastScalarRef(const TensorRef& tr) const;
+
     /// Get data pointer from a TensorRef with \p workload_idx.
     /// Note: can be optimized by computing all input ptrs and output ptr
     /// together.
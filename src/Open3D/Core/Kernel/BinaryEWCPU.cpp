@@ -132,40 +132,58 @@ static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
                                         const Indexer& indexer) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalAndElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPULogicalAndElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::LogicalOr:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalOrElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPULogicalOrElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::LogicalXor:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalXorElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPULogicalXorElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::Gt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUGtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPUGtElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::Lt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPULtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPULtElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::Ge:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPUGeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPUGeqElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::Le:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPULeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPULeqElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::Eq:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUEqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPUEqElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         case BinaryEWOpCode::Ne:
-            CPULauncher::LaunchBinaryEWKernel(
-                    indexer, CPUNeqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, [](const void* lhs, const void* rhs, void* dst) {
+                        CPUNeqElementKernel<src_t, dst_t>(lhs, rhs, dst);
+                    });
             break;
         default:
             break;
@@ -205,20 +223,32 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](const void* lhs, const void* rhs, void* dst) {
+                                CPUAddElementKernel<scalar_t>(lhs, rhs, dst);
+                            });
                     break;
                 case BinaryEWOpCode::Sub:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](const void* lhs, const void* rhs, void* dst) {
+                                CPUSubElementKernel<scalar_t>(lhs, rhs, dst);
+                            });
                     break;
                 case BinaryEWOpCode::Mul:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](const void* lhs, const void* rhs, void* dst) {
+                                CPUMulElementKernel<scalar_t>(lhs, rhs, dst);
+                            });
                     break;
                 case BinaryEWOpCode::Div:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer,
+                            [](const void* lhs, const void* rhs, void* dst) {
+                                CPUDivElementKernel<scalar_t>(lhs, rhs, dst);
+                            });
                     break;
                 default:
                     break;
@@ -40,26 +40,96 @@ namespace kernel {
 
 class CPULauncher {
 public:
-    template <typename func_t>
+    /// Launch an element-wise kernel with one input and one output.
+    ///
+    /// If the input and the output are contiguous in the iteration order,
+    /// the kernel is applied over raw typed spans without the per-element
+    /// offset computation of the Indexer. Together with an inlinable \p
+    /// element_kernel (e.g. a lambda), this allows the compiler to vectorize
+    /// the inner loop.
+    template <typename src_t, typename dst_t, typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
+        int64_t num_workloads = indexer.NumWorkloads();
+        if (indexer.IsOutputContiguous() && indexer.IsInputContiguous(0)) {
+            const src_t* src =
+                    reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+            dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
+            for (int64_t workload_idx = 0; workload_idx < num_workloads;
+                 ++workload_idx) {
+                element_kernel(src + workload_idx, dst + workload_idx);
+            }
+            return;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t workload_idx = 0; workload_idx < num_workloads;
              ++workload_idx) {
             element_kernel(indexer.GetInputPtr(0, workload_idx),
                            indexer.GetOutputPtr(workload_idx));
         }
     }
 
-    template <typename func_t>
+    /// Launch an element-wise kernel with two inputs and one output.
+    ///
+    /// Fast paths are taken when the output is contiguous and each input is
+    /// either contiguous or a broadcasted scalar (e.g. `tensor + 1`). Other
+    /// layouts fall back to the generic Indexer-based loop.
+    template <typename src_t, typename dst_t, typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
+        int64_t num_workloads = indexer.NumWorkloads();
+        if (indexer.IsOutputContiguous()) {
+            const src_t* lhs =
+                    reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+            const src_t* rhs =
+                    reinterpret_cast<const src_t*>(indexer.GetInputPtr(1, 0));
+            dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+            bool lhs_contiguous = indexer.IsInputContiguous(0);
+            bool rhs_contiguous = indexer.IsInputContiguous(1);
+
+            if (lhs_contiguous && rhs_contiguous) {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
+                for (int64_t workload_idx = 0; workload_idx < num_workloads;
+                     ++workload_idx) {
+                    element_kernel(lhs + workload_idx, rhs + workload_idx,
+                                   dst + workload_idx);
+                }
+                return;
+            } else if (lhs_contiguous && indexer.IsInputBroadcastScalar(1)) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                for (int64_t workload_idx = 0; workload_idx < num_workloads;
+                     ++workload_idx) {
+                    element_kernel(lhs + workload_idx, rhs,
+                                   dst + workload_idx);
+                }
+                return;
+            } else if (rhs_contiguous && indexer.IsInputBroadcastScalar(0)) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                for (int64_t workload_idx = 0; workload_idx < num_workloads;
+                     ++workload_idx) {
+                    element_kernel(lhs, rhs + workload_idx,
+                                   dst + workload_idx);
+                }
+                return;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t workload_idx = 0; workload_idx < num_workloads;
              ++workload_idx) {
             element_kernel(indexer.GetInputPtr(0, workload_idx),
                            indexer.GetInputPtr(1, workload_idx),
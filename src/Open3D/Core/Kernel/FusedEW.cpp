@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+int64_t FusedEW::Input(const Tensor& tensor) {
+    if (static_cast<int64_t>(inputs_.size()) >= MAX_INPUTS) {
+        utility::LogError("FusedEW cannot have more than {} inputs.",
+                          MAX_INPUTS);
+    }
+    if (!inputs_.empty()) {
+        if (tensor.GetDtype() != inputs_[0].GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(tensor.GetDtype()),
+                              DtypeUtil::ToString(inputs_[0].GetDtype()));
+        }
+        if (tensor.GetDevice() != inputs_[0].GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              tensor.GetDevice().ToString(),
+                              inputs_[0].GetDevice().ToString());
+        }
+    }
+    Node node;
+    node.type_ = NodeType::Input;
+    node.input_idx_ = static_cast<int64_t>(inputs_.size());
+    inputs_.push_back(tensor);
+    nodes_.push_back(node);
+    return static_cast<int64_t>(nodes_.size()) - 1;
+}
+
+int64_t FusedEW::Unary(UnaryEWOpCode op_code, int64_t src) {
+    if (op_code == UnaryEWOpCode::LogicalNot) {
+        utility::LogError("FusedEW only supports arithmetic ops.");
+    }
+    CheckValueId(src);
+    Node node;
+    node.type_ = NodeType::Unary;
+    node.unary_op_code_ = op_code;
+    node.lhs_ = src;
+    nodes_.push_back(node);
+    return static_cast<int64_t>(nodes_.size()) - 1;
+}
+
+int64_t FusedEW::Binary(BinaryEWOpCode op_code, int64_t lhs, int64_t rhs) {
+    if (s_boolean_binary_ew_op_codes.find(op_code) !=
+        s_boolean_binary_ew_op_codes.end()) {
+        utility::LogError("FusedEW only supports arithmetic ops.");
+    }
+    CheckValueId(lhs);
+    CheckValueId(rhs);
+    Node node;
+    node.type_ = NodeType::Binary;
+    node.binary_op_code_ = op_code;
+    node.lhs_ = lhs;
+    node.rhs_ = rhs;
+    nodes_.push_back(node);
+    return static_cast<int64_t>(nodes_.size()) - 1;
+}
+
+SizeVector FusedEW::GetShape() const {
+    if (inputs_.empty()) {
+        utility::LogError("FusedEW has no inputs.");
+    }
+    SizeVector shape = inputs_[0].GetShape();
+    for (const Tensor& input : inputs_) {
+        shape = shape_util::BroadcastedShape(shape, input.GetShape());
+    }
+    return shape;
+}
+
+Tensor FusedEW::Run(int64_t result) const {
+    Tensor dst(GetShape(), inputs_[0].GetDtype(), inputs_[0].GetDevice());
+    Run(result, dst);
+    return dst;
+}
+
+void FusedEW::Run(int64_t result, Tensor& dst) const {
+    CheckValueId(result);
+    if (dst.GetShape() != GetShape()) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                GetShape(), dst.GetShape());
+    }
+    if (dst.GetDevice() != inputs_[0].GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          dst.GetDevice().ToString(),
+                          inputs_[0].GetDevice().ToString());
+    }
+
+    Dtype dtype = inputs_[0].GetDtype();
+    if (dst.GetDtype() != dtype) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(dst.GetDtype()),
+                          DtypeUtil::ToString(dtype));
+    }
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        for (const Node& node : nodes_) {
+            if (node.type_ == NodeType::Unary &&
+                node.unary_op_code_ != UnaryEWOpCode::Neg &&
+                node.unary_op_code_ != UnaryEWOpCode::Abs) {
+                utility::LogError(
+                        "Only supports Float32 and Float64, but {} is used.",
+                        DtypeUtil::ToString(dtype));
+            }
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(*this, result, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+void FusedEW::CheckValueId(int64_t value_id) const {
+    if (value_id < 0 || value_id >= static_cast<int64_t>(nodes_.size())) {
+        utility::LogError("Invalid FusedEW value id {}.", value_id);
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
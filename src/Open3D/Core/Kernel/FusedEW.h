@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// \class FusedEW
+///
+/// \brief A chain of element-wise ops evaluated in a single pass over memory.
+///
+/// Element-wise ops such as Tensor::Add materialize their full output, so a
+/// chain of n ops makes n passes over memory. FusedEW records the ops instead
+/// and evaluates them tile by tile: the inputs are read once, intermediate
+/// results stay in cache, and only the final result is written to memory.
+///
+/// Input() and every op return a value id that can be consumed by later ops.
+/// All inputs must have the same dtype and device, and are broadcasted to a
+/// common shape. Only arithmetic ops are supported.
+///
+/// Example: dst = (a + b) * c.Sqrt()
+///
+///     kernel::FusedEW fused;
+///     int64_t sum = fused.Binary(BinaryEWOpCode::Add, fused.Input(a),
+///                                fused.Input(b));
+///     int64_t sqrt = fused.Unary(UnaryEWOpCode::Sqrt, fused.Input(c));
+///     Tensor dst = fused.Run(fused.Binary(BinaryEWOpCode::Mul, sum, sqrt));
+class FusedEW {
+public:
+    enum class NodeType { Input, Unary, Binary };
+
+    /// A value in the chain: an input Tensor or the result of an op.
+    struct Node {
+        NodeType type_;
+        /// For NodeType::Input, index of the Tensor in the inputs.
+        int64_t input_idx_ = -1;
+        UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+        BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+        /// Operand value ids. Unary ops only use lhs_.
+        int64_t lhs_ = -1;
+        int64_t rhs_ = -1;
+    };
+
+public:
+    FusedEW() {}
+
+    /// Adds an input Tensor and returns its value id.
+    int64_t Input(const Tensor& tensor);
+
+    /// Adds a unary op on value \p src and returns the id of its result.
+    int64_t Unary(UnaryEWOpCode op_code, int64_t src);
+
+    /// Adds a binary op on values \p lhs and \p rhs and returns the id of its
+    /// result.
+    int64_t Binary(BinaryEWOpCode op_code, int64_t lhs, int64_t rhs);
+
+    /// Evaluates the chain and returns value \p result as a new Tensor.
+    Tensor Run(int64_t result) const;
+
+    /// Evaluates the chain and writes value \p result to \p dst. \p dst must
+    /// have the broadcasted shape of all inputs.
+    void Run(int64_t result, Tensor& dst) const;
+
+    const std::vector<Tensor>& GetInputs() const { return inputs_; }
+    const std::vector<Node>& GetNodes() const { return nodes_; }
+
+    /// Returns the broadcasted shape of all inputs.
+    SizeVector GetShape() const;
+
+protected:
+    void CheckValueId(int64_t value_id) const;
+
+    std::vector<Tensor> inputs_;
+    /// Nodes are stored in topological order, since an op can only consume
+    /// values created before it.
+    std::vector<Node> nodes_;
+};
+
+void FusedEWCPU(const FusedEW& fused, int64_t result, Tensor& dst);
+
+}  // namespace kernel
+}  // namespace open3d
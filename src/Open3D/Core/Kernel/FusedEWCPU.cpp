@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Number of elements processed at once. The intermediate values of a tile
+/// shall fit in the L1/L2 cache.
+static constexpr int64_t TILE_SIZE = 1024;
+
+template <typename scalar_t>
+static void CPUUnaryTileKernel(UnaryEWOpCode op_code,
+                               const scalar_t* src,
+                               scalar_t* dst,
+                               int64_t size) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sqrt(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Sin:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sin(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Cos:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::cos(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Neg:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(-src[i]);
+            }
+            break;
+        case UnaryEWOpCode::Exp:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::exp(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Abs:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::abs(static_cast<double>(src[i])));
+            }
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for FusedEWCPU");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void CPUBinaryTileKernel(BinaryEWOpCode op_code,
+                                const scalar_t* lhs,
+                                const scalar_t* rhs,
+                                scalar_t* dst,
+                                int64_t size) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] + rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Sub:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] - rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Mul:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] * rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Div:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] / rhs[i];
+            }
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for FusedEWCPU");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void LaunchFusedEWCPUKernel(const FusedEW& fused,
+                                   int64_t result,
+                                   const Indexer& indexer) {
+    const std::vector<FusedEW::Node>& nodes = fused.GetNodes();
+    const int64_t num_nodes = result + 1;
+
+    // Only evaluate the nodes that the result depends on.
+    std::vector<bool> is_needed(num_nodes, false);
+    is_needed[result] = true;
+    for (int64_t i = result; i >= 0; --i) {
+        if (is_needed[i] && nodes[i].type_ != FusedEW::NodeType::Input) {
+            is_needed[nodes[i].lhs_] = true;
+            if (nodes[i].type_ == FusedEW::NodeType::Binary) {
+                is_needed[nodes[i].rhs_] = true;
+            }
+        }
+    }
+
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_tiles = (num_workloads + TILE_SIZE - 1) / TILE_SIZE;
+    const bool output_contiguous = indexer.IsOutputContiguous();
+    std::vector<bool> input_contiguous(fused.GetInputs().size());
+    for (size_t i = 0; i < input_contiguous.size(); ++i) {
+        input_contiguous[i] = indexer.IsInputContiguous(i);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Per-thread tile buffers, one per node. Contiguous inputs are read in
+        // place and do not use their buffers.
+        std::vector<scalar_t> buffers(num_nodes * TILE_SIZE);
+        std::vector<const scalar_t*> values(num_nodes, nullptr);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+            const int64_t start = tile_idx * TILE_SIZE;
+            const int64_t size = std::min(TILE_SIZE, num_workloads - start);
+
+            for (int64_t i = 0; i < num_nodes; ++i) {
+                if (!is_needed[i]) {
+                    continue;
+                }
+                const FusedEW::Node& node = nodes[i];
+                scalar_t* buffer = buffers.data() + i * TILE_SIZE;
+                if (node.type_ == FusedEW::NodeType::Input) {
+                    if (input_contiguous[node.input_idx_]) {
+                        values[i] = reinterpret_cast<const scalar_t*>(
+                                            indexer.GetInputPtr(
+                                                    node.input_idx_, 0)) +
+                                    start;
+                    } else {
+                        for (int64_t j = 0; j < size; ++j) {
+                            buffer[j] = *reinterpret_cast<const scalar_t*>(
+                                    indexer.GetInputPtr(node.input_idx_,
+                                                        start + j));
+                        }
+                        values[i] = buffer;
+                    }
+                } else if (node.type_ == FusedEW::NodeType::Unary) {
+                    CPUUnaryTileKernel<scalar_t>(node.unary_op_code_,
+                                                 values[node.lhs_], buffer,
+                                                 size);
+                    values[i] = buffer;
+                } else {
+                    CPUBinaryTileKernel<scalar_t>(
+                            node.binary_op_code_, values[node.lhs_],
+                            values[node.rhs_], buffer, size);
+                    values[i] = buffer;
+                }
+            }
+
+            const scalar_t* result_values = values[result];
+            if (output_contiguous) {
+                scalar_t* dst = reinterpret_cast<scalar_t*>(
+                                        indexer.GetOutputPtr(0)) +
+                                start;
+                for (int64_t j = 0; j < size; ++j) {
+                    dst[j] = result_values[j];
+                }
+            } else {
+                for (int64_t j = 0; j < size; ++j) {
+                    *reinterpret_cast<scalar_t*>(
+                            indexer.GetOutputPtr(start + j)) = result_values[j];
+                }
+            }
+        }
+    }
+}
+
+void FusedEWCPU(const FusedEW& fused, int64_t result, Tensor& dst) {
+    Indexer indexer(fused.GetInputs(), dst, DtypePolicy::ASSERT_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        LaunchFusedEWCPUKernel<scalar_t>(fused, result, indexer);
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
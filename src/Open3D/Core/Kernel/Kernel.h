@@ -27,6 +27,8 @@
 #pragma once
 
 #include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/FusedEW.h"
 #include "Open3D/Core/Kernel/IndexGetSet.h"
+#include "Open3D/Core/Kernel/Matmul.h"
 #include "Open3D/Core/Kernel/Reduction.h"
 #include "Open3D/Core/Kernel/UnaryEW.h"
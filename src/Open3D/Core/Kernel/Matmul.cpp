@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Matmul.h"
+
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    // lhs, rhs and dst must be on the same device and have the same dtype.
+    for (const Tensor* tensor : std::vector<const Tensor*>{&rhs, &dst}) {
+        if (lhs.GetDevice() != tensor->GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              lhs.GetDevice().ToString(),
+                              tensor->GetDevice().ToString());
+        }
+        if (lhs.GetDtype() != tensor->GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(lhs.GetDtype()),
+                              DtypeUtil::ToString(tensor->GetDtype()));
+        }
+    }
+
+    if (lhs.NumDims() != 3 || rhs.NumDims() != 3 || dst.NumDims() != 3) {
+        utility::LogError(
+                "Batched matmul expects 3D tensors, but got lhs {}, rhs {} "
+                "and dst {}.",
+                lhs.GetShape(), rhs.GetShape(), dst.GetShape());
+    }
+    if (lhs.GetShape(0) != rhs.GetShape(0) ||
+        lhs.GetShape(2) != rhs.GetShape(1) ||
+        dst.GetShape() != SizeVector({lhs.GetShape(0), lhs.GetShape(1),
+                                      rhs.GetShape(2)})) {
+        utility::LogError(
+                "Matmul shape mismatch: lhs {}, rhs {} and dst {}.",
+                lhs.GetShape(), rhs.GetShape(), dst.GetShape());
+    }
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MatmulCPU(lhs, rhs, dst);
+    } else {
+        utility::LogError("Matmul: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
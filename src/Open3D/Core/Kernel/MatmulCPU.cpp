@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Matmul.h"
+
+#include <Eigen/Core>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Computes each output row of a (b, m, K) x (b, K, N) product directly. With
+/// compile-time K and N the row fits in registers and the loops unroll; GEMM
+/// packing would dominate at these sizes.
+template <typename scalar_t, int64_t K, int64_t N>
+static void CPUSmallMatmulKernel(const scalar_t* lhs,
+                                 const scalar_t* rhs,
+                                 scalar_t* dst,
+                                 int64_t batch_size,
+                                 int64_t m) {
+    // Rows are split across threads, so a single (m, K) x (K, N) product is
+    // parallelized as well as a batch.
+    const int64_t num_rows = batch_size * m;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+        const scalar_t* lhs_row = lhs + row_idx * K;
+        const scalar_t* rhs_mat = rhs + (row_idx / m) * K * N;
+        scalar_t acc[N] = {0};
+        for (int64_t i = 0; i < K; ++i) {
+            for (int64_t j = 0; j < N; ++j) {
+                acc[j] += lhs_row[i] * rhs_mat[i * N + j];
+            }
+        }
+        for (int64_t j = 0; j < N; ++j) {
+            dst[row_idx * N + j] = acc[j];
+        }
+    }
+}
+
+template <typename scalar_t>
+static void CPUMatmulKernel(const scalar_t* lhs,
+                            const scalar_t* rhs,
+                            scalar_t* dst,
+                            int64_t batch_size,
+                            int64_t m,
+                            int64_t k,
+                            int64_t n) {
+    using Matrix = Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic,
+                                 Eigen::RowMajor>;
+    // Skinny products, e.g. (N, 3) points times a 3x3 rotation, or batches of
+    // 6x6 normal equations.
+    if (k == 3 && n == 3) {
+        CPUSmallMatmulKernel<scalar_t, 3, 3>(lhs, rhs, dst, batch_size, m);
+        return;
+    } else if (k == 4 && n == 4) {
+        CPUSmallMatmulKernel<scalar_t, 4, 4>(lhs, rhs, dst, batch_size, m);
+        return;
+    } else if (k == 6 && n == 6) {
+        CPUSmallMatmulKernel<scalar_t, 6, 6>(lhs, rhs, dst, batch_size, m);
+        return;
+    }
+
+    if (batch_size == 1) {
+        // Eigen's GEMM is blocked for the cache hierarchy, and multithreaded
+        // when compiled with OpenMP. It calls BLAS if EIGEN_USE_BLAS is set.
+        Eigen::Map<Matrix>(dst, m, n).noalias() =
+                Eigen::Map<const Matrix>(lhs, m, k) *
+                Eigen::Map<const Matrix>(rhs, k, n);
+        return;
+    }
+
+    // Batches of larger matrices are parallelized over the batch dimension.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        Eigen::Map<Matrix>(dst + batch_idx * m * n, m, n).noalias() =
+                Eigen::Map<const Matrix>(lhs + batch_idx * m * k, m, k) *
+                Eigen::Map<const Matrix>(rhs + batch_idx * k * n, k, n);
+    }
+}
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    Tensor lhs_contiguous = lhs.Contiguous();
+    Tensor rhs_contiguous = rhs.Contiguous();
+    Tensor dst_contiguous =
+            dst.IsContiguous() ? dst
+                               : Tensor(dst.GetShape(), dst.GetDtype(),
+                                        dst.GetDevice());
+
+    DISPATCH_DTYPE_TO_TEMPLATE(lhs.GetDtype(), [&]() {
+        CPUMatmulKernel<scalar_t>(
+                static_cast<const scalar_t*>(lhs_contiguous.GetDataPtr()),
+                static_cast<const scalar_t*>(rhs_contiguous.GetDataPtr()),
+                static_cast<scalar_t*>(dst_contiguous.GetDataPtr()),
+                lhs.GetShape(0), lhs.GetShape(1), lhs.GetShape(2),
+                rhs.GetShape(2));
+    });
+
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
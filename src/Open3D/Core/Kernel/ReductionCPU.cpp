@@ -77,41 +77,101 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Reductions with at most this many outputs use per-thread partial buffers.
+static constexpr int64_t MAX_THREAD_PARTIAL_OUTPUTS = 1024;
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
     CPUReductionEngine& operator=(const CPUReductionEngine&) = delete;
-    CPUReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
+    /// \param indexer Reduction indexer.
+    /// \param is_dst_contiguous If true, output element i is stored at offset
+    /// i from the start of the output, which enables per-thread partial
+    /// buffers for reductions with few outputs.
+    CPUReductionEngine(const Indexer& indexer, bool is_dst_contiguous)
+        : indexer_(indexer), is_dst_contiguous_(is_dst_contiguous) {}
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (parallel_util::GetMaxThreads() == 1 ||
-            parallel_util::InParallel()) {
+        int64_t num_threads = parallel_util::GetMaxThreads();
+        if (num_threads == 1 || parallel_util::InParallel()) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
                                                    identity);
+        } else if (indexer_.NumOutputElements() <= MAX_THREAD_PARTIAL_OUTPUTS &&
+                   is_dst_contiguous_) {
+            // Few outputs, e.g. column sums of a (N, 3) or (N, 33) tensor.
+            // Splitting over the outputs would leave threads idle or make each
+            // thread stride through the whole input, so split the workloads
+            // instead.
+            LaunchReductionKernelThreadPartial<scalar_t>(indexer_, reduce_func,
+                                                         identity);
         } else {
             LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
         }
     }
 
 private:
+    /// Reduces workloads [start, end) into \p dst_ptr, which has the layout
+    /// of the indexer's output. The input and output offsets are advanced
+    /// incrementally instead of being recomputed for every workload.
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelSerial(const Indexer& indexer,
-                                            func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
+    static void ReduceWorkloadRange(const Indexer& indexer,
+                                    int64_t start,
+                                    int64_t end,
+                                    char* dst_ptr,
+                                    func_t element_kernel) {
+        if (start >= end) {
+            return;
+        }
+        const int64_t ndims = indexer.NumDims();
+        const int64_t* shape = indexer.GetMasterShape();
+        const int64_t* master_strides = indexer.GetMasterStrides();
+        const int64_t* src_strides = indexer.GetInput(0).byte_strides_;
+        const int64_t* dst_strides = indexer.GetOutput().byte_strides_;
+        const char* src_ptr =
+                static_cast<const char*>(indexer.GetInput(0).data_ptr_);
+
+        int64_t index[MAX_DIMS];
+        int64_t src_offset = 0;
+        int64_t dst_offset = 0;
+        int64_t remainder = start;
+        for (int64_t i = 0; i < ndims; ++i) {
+            index[i] = remainder / master_strides[i];
+            remainder = remainder % master_strides[i];
+            src_offset += index[i] * src_strides[i];
+            dst_offset += index[i] * dst_strides[i];
+        }
+
+        for (int64_t workload_idx = start; workload_idx < end;
              ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
+            const scalar_t* src =
+                    reinterpret_cast<const scalar_t*>(src_ptr + src_offset);
+            scalar_t* dst = reinterpret_cast<scalar_t*>(dst_ptr + dst_offset);
             *dst = element_kernel(*src, *dst);
+            for (int64_t i = ndims - 1; i >= 0; --i) {
+                src_offset += src_strides[i];
+                dst_offset += dst_strides[i];
+                if (++index[i] < shape[i]) {
+                    break;
+                }
+                src_offset -= src_strides[i] * shape[i];
+                dst_offset -= dst_strides[i] * shape[i];
+                index[i] = 0;
+            }
         }
     }
 
+    template <typename scalar_t, typename func_t>
+    static void LaunchReductionKernelSerial(const Indexer& indexer,
+                                            func_t element_kernel) {
+        ReduceWorkloadRange<scalar_t>(indexer, 0, indexer.NumWorkloads(),
+                                      indexer.GetOutputPtr(0), element_kernel);
+    }
+
     /// Create num_threads workers to compute partial reductions and then reduce
     /// to the final results. This only applies to reduction op with one output.
     template <typename scalar_t, typename func_t>
@@ -135,13 +195,10 @@ private:
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
-            }
+            ReduceWorkloadRange<scalar_t>(
+                    indexer, start, end,
+                    reinterpret_cast<char*>(&thread_results[thread_idx]),
+                    element_kernel);
         }
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
@@ -149,6 +206,46 @@ private:
         }
     }
 
+    /// Each thread reduces a contiguous range of workloads into its own
+    /// buffer of all output elements, then the buffers are reduced into the
+    /// output in thread order. The output must be contiguous.
+    template <typename scalar_t, typename func_t>
+    static void LaunchReductionKernelThreadPartial(const Indexer& indexer,
+                                                   func_t element_kernel,
+                                                   scalar_t identity) {
+        int64_t num_workloads = indexer.NumWorkloads();
+        int64_t num_outputs = indexer.NumOutputElements();
+        int64_t num_threads = parallel_util::GetMaxThreads();
+        int64_t workload_per_thread =
+                (num_workloads + num_threads - 1) / num_threads;
+        std::vector<scalar_t> thread_results(num_threads * num_outputs,
+                                             identity);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            int64_t start = thread_idx * workload_per_thread;
+            int64_t end = std::min(start + workload_per_thread, num_workloads);
+            ReduceWorkloadRange<scalar_t>(
+                    indexer, start, end,
+                    reinterpret_cast<char*>(thread_results.data() +
+                                            thread_idx * num_outputs),
+                    element_kernel);
+        }
+
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            const scalar_t* thread_dst =
+                    thread_results.data() + thread_idx * num_outputs;
+            for (int64_t output_idx = 0; output_idx < num_outputs;
+                 ++output_idx) {
+                dst[output_idx] =
+                        element_kernel(thread_dst[output_idx], dst[output_idx]);
+            }
+        }
+    }
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionParallelDim(const Indexer& indexer,
                                            func_t element_kernel) {
@@ -189,6 +286,7 @@ private:
 
 private:
     Indexer indexer_;
+    bool is_dst_contiguous_;
 };
 
 class CPUArgReductionEngine {
@@ -242,7 +340,7 @@ void ReductionCPU(const Tensor& src,
     if (regular_reduce_ops.find(op_code) != regular_reduce_ops.end()) {
         DtypePolicy dtype_policy = DtypePolicy::ASSERT_SAME;
         Indexer indexer({src}, dst, dtype_policy, dims);
-        CPUReductionEngine re(indexer);
+        CPUReductionEngine re(indexer, dst.IsContiguous());
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
@@ -104,8 +104,10 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
-                CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPUCopyElementKernel<src_t, dst_t>);
+                CPULauncher::LaunchUnaryEWKernel<src_t, dst_t>(
+                        indexer, [](const void* src, void* dst) {
+                            CPUCopyElementKernel<src_t, dst_t>(src, dst);
+                        });
             });
         });
     }
@@ -130,8 +132,10 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
-                CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPULogicalNotElementKernel<src_t, dst_t>);
+                CPULauncher::LaunchUnaryEWKernel<src_t, dst_t>(
+                        indexer, [](const void* src, void* dst) {
+                            CPULogicalNotElementKernel<src_t, dst_t>(src, dst);
+                        });
             });
         });
     } else {
@@ -139,31 +143,43 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](const void* src, void* dst) {
+                                CPUSqrtElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSinElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](const void* src, void* dst) {
+                                CPUSinElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCosElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](const void* src, void* dst) {
+                                CPUCosElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Neg:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](const void* src, void* dst) {
+                                CPUNegElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUExpElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](const void* src, void* dst) {
+                                CPUExpElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Abs:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, [](const void* src, void* dst) {
+                                CPUAbsElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
@@ -92,6 +92,19 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::ReleaseCache(const Device& device) {
+    GetDeviceMemoryManager(device)->ReleaseCache();
+}
+
+MemoryCacheStatistics MemoryManager::GetCacheStatistics(const Device& device) {
+    return GetDeviceMemoryManager(device)->GetCacheStatistics();
+}
+
+void MemoryManager::SetCacheLimit(const Device& device,
+                                  int64_t max_cached_bytes) {
+    GetDeviceMemoryManager(device)->SetCacheLimit(max_cached_bytes);
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
@@ -38,6 +39,16 @@ namespace open3d {
 
 class DeviceMemoryManager;
 
+/// Statistics of a caching DeviceMemoryManager.
+struct MemoryCacheStatistics {
+    /// Number of Malloc calls served from the cache.
+    int64_t num_hits_ = 0;
+    /// Number of Malloc calls forwarded to the system allocator.
+    int64_t num_misses_ = 0;
+    /// Number of bytes currently held in the cache.
+    int64_t cached_bytes_ = 0;
+};
+
 class MemoryManager {
 public:
     static void* Malloc(size_t byte_size, const Device& device);
@@ -58,6 +69,16 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Releases the memory blocks cached by \p device 's memory manager back
+    /// to the system.
+    static void ReleaseCache(const Device& device);
+    /// Returns the cache statistics of \p device 's memory manager.
+    static MemoryCacheStatistics GetCacheStatistics(const Device& device);
+    /// Sets the maximum number of bytes \p device 's memory manager may keep
+    /// cached. Setting it to 0 disables caching. Lowering it frees cached
+    /// blocks down to the new limit, except those cached by other threads.
+    static void SetCacheLimit(const Device& device, int64_t max_cached_bytes);
+
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
@@ -72,8 +93,24 @@ public:
                         const void* src_ptr,
                         const Device& src_device,
                         size_t num_bytes) = 0;
+
+    /// Memory managers without a cache do not need to override the following
+    /// functions.
+    virtual void ReleaseCache() {}
+    virtual MemoryCacheStatistics GetCacheStatistics() const {
+        return MemoryCacheStatistics();
+    }
+    virtual void SetCacheLimit(int64_t max_cached_bytes) {}
 };
 
+/// CPU memory manager with a size-bucketed caching allocator.
+///
+/// All blocks are 64-byte aligned. Freed blocks are kept in a cache and reused
+/// by subsequent Malloc calls of the same bucket size, which avoids repeated
+/// system allocations (and page faults) for intermediate Tensors. Small blocks
+/// are cached per thread first; the remaining blocks are shared by all threads
+/// in a global cache. See MemoryManager::ReleaseCache and
+/// MemoryManager::SetCacheLimit to control the cache.
 class CPUMemoryManager : public DeviceMemoryManager {
 public:
     CPUMemoryManager();
@@ -84,6 +121,12 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+
+    /// Releases the global cache and the calling thread's cache. Caches of
+    /// other threads are released when those threads exit.
+    void ReleaseCache() override;
+    MemoryCacheStatistics GetCacheStatistics() const override;
+    void SetCacheLimit(int64_t max_cached_bytes) override;
 };
 
 #ifdef BUILD_CUDA_MODULE
@@ -26,25 +26,287 @@
 
 #include "Open3D/Core/MemoryManager.h"
 
+#include <atomic>
 #include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "Open3D/Utility/Console.h"
 
 namespace open3d {
 
-CPUMemoryManager::CPUMemoryManager() {}
+namespace {
 
-void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
-    void* ptr;
-    ptr = std::malloc(byte_size);
-    if (byte_size != 0 && !ptr) {
-        utility::LogError("CPU malloc failed");
+/// Alignment of all blocks returned by CPUMemoryManager, i.e. the cache line
+/// size and the width of AVX-512 registers.
+constexpr size_t kAlignment = 64;
+
+/// Every block is preceded by a header storing its bucket size. The header
+/// occupies a full alignment unit to keep the returned pointer aligned.
+constexpr size_t kHeaderSize = kAlignment;
+
+/// Blocks up to this size are cached in thread-local caches first.
+constexpr size_t kMaxThreadCacheBlockSize = 1 << 20;
+
+/// Maximum number of blocks per bucket in a thread-local cache.
+constexpr size_t kMaxThreadCacheBlocksPerBucket = 16;
+
+/// Default maximum number of cached bytes over all caches.
+constexpr int64_t kDefaultCacheLimit = 1LL << 30;
+
+void* AlignedMalloc(size_t byte_size) {
+#ifdef _WIN32
+    return _aligned_malloc(byte_size, kAlignment);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, kAlignment, byte_size) != 0) {
+        return nullptr;
     }
     return ptr;
+#endif
 }
 
-void CPUMemoryManager::Free(void* ptr, const Device& device) {
-    if (ptr) {
-        std::free(ptr);
+void AlignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+/// Rounds \p byte_size up to its bucket size. There are 4 buckets between
+/// consecutive powers of two, so at most 25% of a block is wasted.
+size_t GetBucketSize(size_t byte_size) {
+    if (byte_size <= kAlignment) {
+        return kAlignment;
+    }
+    size_t power = kAlignment;
+    while (power < byte_size) {
+        power <<= 1;
+    }
+    size_t step = power / 8;
+    return (byte_size + step - 1) / step * step;
+}
+
+size_t& BlockBucketSize(char* block) {
+    return *reinterpret_cast<size_t*>(block);
+}
+
+class CPUMemoryPool {
+public:
+    static CPUMemoryPool& GetInstance() {
+        // Never destroyed, such that thread-local caches can return their
+        // blocks at thread exit regardless of the static destruction order.
+        static CPUMemoryPool* instance = new CPUMemoryPool();
+        return *instance;
+    }
+
+    void* Malloc(size_t byte_size) {
+        if (byte_size == 0) {
+            return nullptr;
+        }
+        size_t bucket_size = GetBucketSize(byte_size);
+
+        char* block = nullptr;
+        ThreadCache* thread_cache = GetThreadCache();
+        if (thread_cache && bucket_size <= kMaxThreadCacheBlockSize) {
+            block = PopBlock(thread_cache->blocks_, bucket_size);
+        }
+        if (!block) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            block = PopBlock(global_blocks_, bucket_size);
+        }
+
+        if (block) {
+            num_hits_++;
+            cached_bytes_ -= bucket_size;
+        } else {
+            num_misses_++;
+            block = static_cast<char*>(
+                    AlignedMalloc(bucket_size + kHeaderSize));
+            if (!block) {
+                // Give the cached memory back to the system and retry.
+                ReleaseCache();
+                block = static_cast<char*>(
+                        AlignedMalloc(bucket_size + kHeaderSize));
+            }
+            if (!block) {
+                utility::LogError("CPU malloc failed");
+            }
+            BlockBucketSize(block) = bucket_size;
+        }
+        return block + kHeaderSize;
+    }
+
+    void Free(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        char* block = static_cast<char*>(ptr) - kHeaderSize;
+        size_t bucket_size = BlockBucketSize(block);
+
+        ThreadCache* thread_cache = GetThreadCache();
+        if (thread_cache && bucket_size <= kMaxThreadCacheBlockSize) {
+            std::vector<char*>& blocks = thread_cache->blocks_[bucket_size];
+            if (blocks.size() < kMaxThreadCacheBlocksPerBucket &&
+                ReserveCache(bucket_size)) {
+                blocks.push_back(block);
+                return;
+            }
+        }
+        PushGlobalBlock(block);
+    }
+
+    void ReleaseCache() {
+        if (ThreadCache* thread_cache = GetThreadCache()) {
+            for (auto& kv : thread_cache->blocks_) {
+                for (char* block : kv.second) {
+                    cached_bytes_ -= kv.first;
+                    AlignedFree(block);
+                }
+                kv.second.clear();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : global_blocks_) {
+            for (char* block : kv.second) {
+                cached_bytes_ -= kv.first;
+                AlignedFree(block);
+            }
+        }
+        global_blocks_.clear();
+    }
+
+    MemoryCacheStatistics GetStatistics() const {
+        MemoryCacheStatistics statistics;
+        statistics.num_hits_ = num_hits_;
+        statistics.num_misses_ = num_misses_;
+        statistics.cached_bytes_ = cached_bytes_;
+        return statistics;
+    }
+
+    /// Lowering the limit frees cached blocks of the calling thread and of
+    /// the global cache until it is met. Blocks cached by other threads are
+    /// freed when those threads exit.
+    void SetCacheLimit(int64_t max_cached_bytes) {
+        cache_limit_ = max_cached_bytes;
+        if (cached_bytes_ <= max_cached_bytes) {
+            return;
+        }
+        if (ThreadCache* thread_cache = GetThreadCache()) {
+            TrimBlocks(thread_cache->blocks_);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        TrimBlocks(global_blocks_);
+    }
+
+private:
+    /// Blocks cached by one thread, indexed by bucket size.
+    struct ThreadCache {
+        ~ThreadCache() {
+            ThreadCacheDestroyed() = true;
+            CPUMemoryPool& pool = CPUMemoryPool::GetInstance();
+            for (auto& kv : blocks_) {
+                for (char* block : kv.second) {
+                    pool.cached_bytes_ -= kv.first;
+                    pool.PushGlobalBlock(block);
+                }
+            }
+        }
+        std::unordered_map<size_t, std::vector<char*>> blocks_;
+    };
+
+    CPUMemoryPool() {}
+
+    /// Set when the calling thread's cache is destroyed at thread exit, after
+    /// which objects destroyed later, such as static Tensors of the main
+    /// thread, still free their blocks. Being trivially destructible, the flag
+    /// outlives the cache.
+    static bool& ThreadCacheDestroyed() {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    /// Returns the calling thread's cache, or null once it is destroyed.
+    static ThreadCache* GetThreadCache() {
+        if (ThreadCacheDestroyed()) {
+            return nullptr;
+        }
+        static thread_local ThreadCache thread_cache;
+        return &thread_cache;
+    }
+
+    static char* PopBlock(
+            std::unordered_map<size_t, std::vector<char*>>& blocks,
+            size_t bucket_size) {
+        auto it = blocks.find(bucket_size);
+        if (it == blocks.end() || it->second.empty()) {
+            return nullptr;
+        }
+        char* block = it->second.back();
+        it->second.pop_back();
+        return block;
+    }
+
+    /// Accounts \p bucket_size bytes to the cache. Returns false if the cache
+    /// limit would be exceeded.
+    bool ReserveCache(size_t bucket_size) {
+        int64_t new_cached_bytes = cached_bytes_ += bucket_size;
+        if (new_cached_bytes > cache_limit_) {
+            cached_bytes_ -= bucket_size;
+            return false;
+        }
+        return true;
+    }
+
+    /// Frees blocks from \p blocks while more bytes than the cache limit are
+    /// cached.
+    void TrimBlocks(std::unordered_map<size_t, std::vector<char*>>& blocks) {
+        for (auto& kv : blocks) {
+            while (!kv.second.empty() && cached_bytes_ > cache_limit_) {
+                cached_bytes_ -= kv.first;
+                AlignedFree(kv.second.back());
+                kv.second.pop_back();
+            }
+        }
+    }
+
+    /// Puts \p block into the global cache, or frees it if the cache is full.
+    void PushGlobalBlock(char* block) {
+        size_t bucket_size = BlockBucketSize(block);
+        if (!ReserveCache(bucket_size)) {
+            AlignedFree(block);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        global_blocks_[bucket_size].push_back(block);
     }
+
+    std::mutex mutex_;
+    std::unordered_map<size_t, std::vector<char*>> global_blocks_;
+
+    std::atomic<int64_t> num_hits_{0};
+    std::atomic<int64_t> num_misses_{0};
+    std::atomic<int64_t> cached_bytes_{0};
+    std::atomic<int64_t> cache_limit_{kDefaultCacheLimit};
+};
+
+}  // namespace
+
+CPUMemoryManager::CPUMemoryManager() {}
+
+void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    return CPUMemoryPool::GetInstance().Malloc(byte_size);
+}
+
+void CPUMemoryManager::Free(void* ptr, const Device& device) {
+    CPUMemoryPool::GetInstance().Free(ptr);
 }
 
 void CPUMemoryManager::Memcpy(void* dst_ptr,
@@ -55,4 +317,16 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+void CPUMemoryManager::ReleaseCache() {
+    CPUMemoryPool::GetInstance().ReleaseCache();
+}
+
+MemoryCacheStatistics CPUMemoryManager::GetCacheStatistics() const {
+    return CPUMemoryPool::GetInstance().GetStatistics();
+}
+
+void CPUMemoryManager::SetCacheLimit(int64_t max_cached_bytes) {
+    CPUMemoryPool::GetInstance().SetCacheLimit(max_cached_bytes);
+}
+
 }  // namespace open3d
@@ -674,6 +674,37 @@ Tensor Tensor::Div_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Matmul(const Tensor& rhs) const {
+    if (NumDims() != 2 || rhs.NumDims() != 2) {
+        utility::LogError("Matmul expects 2D tensors, but got {} and {}.",
+                          shape_, rhs.shape_);
+    }
+    if (shape_[1] != rhs.shape_[0]) {
+        utility::LogError("Matmul shape mismatch: {} and {}.", shape_,
+                          rhs.shape_);
+    }
+    Tensor dst({shape_[0], rhs.shape_[1]}, dtype_, GetDevice());
+    Tensor dst_batch = dst.View({1, shape_[0], rhs.shape_[1]});
+    kernel::Matmul(Reshape({1, shape_[0], shape_[1]}),
+                   rhs.Reshape({1, rhs.shape_[0], rhs.shape_[1]}), dst_batch);
+    return dst;
+}
+
+Tensor Tensor::BatchMatmul(const Tensor& rhs) const {
+    if (NumDims() != 3 || rhs.NumDims() != 3) {
+        utility::LogError(
+                "BatchMatmul expects 3D tensors, but got {} and {}.", shape_,
+                rhs.shape_);
+    }
+    if (shape_[0] != rhs.shape_[0] || shape_[2] != rhs.shape_[1]) {
+        utility::LogError("BatchMatmul shape mismatch: {} and {}.", shape_,
+                          rhs.shape_);
+    }
+    Tensor dst({shape_[0], shape_[1], rhs.shape_[2]}, dtype_, GetDevice());
+    kernel::Matmul(*this, rhs, dst);
+    return dst;
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
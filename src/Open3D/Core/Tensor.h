@@ -498,6 +498,14 @@ public:
         return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Matrix multiplication of a (m, k) tensor with a (k, n) tensor. Returns
+    /// a new (m, n) tensor.
+    Tensor Matmul(const Tensor& rhs) const;
+
+    /// Batched matrix multiplication of a (b, m, k) tensor with a (b, k, n)
+    /// tensor. Returns a new (b, m, n) tensor.
+    Tensor BatchMatmul(const Tensor& rhs) const;
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
@@ -25,9 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudFloat.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
@@ -217,7 +221,8 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
     }
 }
 
-Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
+template <typename CloudType>
+Eigen::Vector3d ComputeNormal(const CloudType &cloud,
                               const std::vector<int> &indices,
                               bool fast_normal_computation) {
     if (indices.size() == 0) {
@@ -227,7 +232,8 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
     for (size_t i = 0; i < indices.size(); i++) {
-        const Eigen::Vector3d &point = cloud.points_[indices[i]];
+        const Eigen::Vector3d point =
+                cloud.points_[indices[i]].template cast<double>();
         cumulants(0) += point(0);
         cumulants(1) += point(1);
         cumulants(2) += point(2);
@@ -258,6 +264,49 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
+/// Estimates the normal of every point of \p cloud from its neighbors found
+/// in a KDTreeFlann, oriented along the previous normal if there is one.
+template <typename CloudType>
+void EstimateNormalsWithKDTree(CloudType &cloud,
+                               const KDTreeSearchParam &search_param,
+                               bool fast_normal_computation) {
+    using Scalar = typename std::remove_reference<decltype(
+            cloud.normals_[0])>::type::Scalar;
+    bool has_normal = cloud.HasNormals();
+    if (cloud.HasNormals() == false) {
+        cloud.normals_.resize(cloud.points_.size());
+    }
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(cloud);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)cloud.points_.size(); i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        Eigen::Vector3d normal;
+        if (kdtree.Search(cloud.points_[i], search_param, indices,
+                          distance2) >= 3) {
+            normal = ComputeNormal(cloud, indices, fast_normal_computation);
+            if (has_normal) {
+                const Eigen::Vector3d previous_normal =
+                        cloud.normals_[i].template cast<double>();
+                if (normal.norm() == 0.0) {
+                    normal = previous_normal;
+                } else if (normal.dot(previous_normal) < 0.0) {
+                    normal *= -1.0;
+                }
+            } else if (normal.norm() == 0.0) {
+                normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+            }
+            cloud.normals_[i] = normal.template cast<Scalar>();
+        } else {
+            cloud.normals_[i] =
+                    Eigen::Vector3d(0.0, 0.0, 1.0).template cast<Scalar>();
+        }
+    }
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -265,37 +314,91 @@ namespace geometry {
 bool PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
+    EstimateNormalsWithKDTree(*this, search_param, fast_normal_computation);
+    return true;
+}
+
+bool PointCloud::EstimateNormalsOrganized(
+        int window_radius /* = 2 */,
+        double max_neighbor_distance /* = 0.05 */,
+        bool fast_normal_computation /* = true */) {
+    if (!IsOrganized()) {
+        utility::LogWarning(
+                "[EstimateNormalsOrganized] The point cloud is not "
+                "organized.");
+        return false;
+    }
+    if (window_radius < 1 || max_neighbor_distance <= 0) {
+        utility::LogError(
+                "[EstimateNormalsOrganized] Illegal input parameters, window "
+                "radius and neighbor distance must be positive.");
+    }
     bool has_normal = HasNormals();
     if (HasNormals() == false) {
         normals_.resize(points_.size());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
+    const double max_distance2 = max_neighbor_distance * max_neighbor_distance;
+    const Eigen::Vector3d invalid_normal =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::quiet_NaN());
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel
 #endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    {
         std::vector<int> indices;
-        std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int v = 0; v < height_; v++) {
+            int v_min = std::max(v - window_radius, 0);
+            int v_max = std::min(v + window_radius, height_ - 1);
+            for (int u = 0; u < width_; u++) {
+                int i = v * width_ + u;
+                const Eigen::Vector3d &point = points_[i];
+                if (!point.allFinite()) {
+                    normals_[i] = invalid_normal;
+                    continue;
+                }
+                // NaN points fail the distance test.
+                indices.clear();
+                int u_min = std::max(u - window_radius, 0);
+                int u_max = std::min(u + window_radius, width_ - 1);
+                for (int nv = v_min; nv <= v_max; nv++) {
+                    for (int nu = u_min; nu <= u_max; nu++) {
+                        int j = nv * width_ + nu;
+                        if ((points_[j] - point).squaredNorm() <=
+                            max_distance2) {
+                            indices.push_back(j);
+                        }
+                    }
+                }
+                Eigen::Vector3d normal;
+                if (indices.size() >= 3) {
+                    normal = ComputeNormal(*this, indices,
+                                           fast_normal_computation);
+                    if (normal.norm() == 0.0) {
+                        if (has_normal && normals_[i].allFinite()) {
+                            normal = normals_[i];
+                        } else {
+                            normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                        }
+                    }
+                    if (has_normal && normal.dot(normals_[i]) < 0.0) {
+                        normal *= -1.0;
+                    }
+                    normals_[i] = normal;
                 } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                    normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
                 }
             }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
         }
     }
+    return true;
+}
 
+bool PointCloudFloat::EstimateNormals(
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
+        bool fast_normal_computation /* = true */) {
+    EstimateNormalsWithKDTree(*this, search_param, fast_normal_computation);
     return true;
 }
 
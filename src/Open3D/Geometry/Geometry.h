@@ -69,7 +69,10 @@ public:
         /// TriangleMeshCuda
         TriangleMeshCuda = 14,
         /// ImageCuda
-        ImageCuda = 15   };
+        ImageCuda = 15,
+        /// PointCloudFloat
+        PointCloudFloat = 16
+    };
 
 public:
     virtual ~Geometry() {}
@@ -31,16 +31,397 @@
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <flann/flann.hpp>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudFloat.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+template <typename scalar_t>
+using FlannIndex = flann::KDTreeSingleIndex<flann::L2<scalar_t>>;
+
+template <typename scalar_t>
+using Neighbors = std::vector<flann::DistanceIndex<scalar_t>>;
+
+/// Keeps the \p capacity nearest points closer than \p max_distance2, sorted
+/// by distance and written straight into caller-owned buffers.
+template <typename DistanceType>
+class KNNResultSet : public flann::ResultSet<DistanceType> {
+public:
+    KNNResultSet(size_t capacity,
+                 DistanceType max_distance2,
+                 int *indices,
+                 double *distance2)
+        : capacity_(capacity),
+          worst_distance2_(max_distance2),
+          indices_(indices),
+          distance2_(distance2) {}
+
+    bool full() const override { return count_ == capacity_; }
+
+    void addPoint(DistanceType dist, size_t index) override {
+        if (dist >= worst_distance2_) return;
+        if (count_ < capacity_) count_++;
+        size_t i = count_ - 1;
+        for (; i > 0 && distance2_[i - 1] > dist; i--) {
+            indices_[i] = indices_[i - 1];
+            distance2_[i] = distance2_[i - 1];
+        }
+        indices_[i] = int(index);
+        distance2_[i] = double(dist);
+        if (count_ == capacity_) {
+            worst_distance2_ = DistanceType(distance2_[capacity_ - 1]);
+        }
+    }
+
+    DistanceType worstDist() const override { return worst_distance2_; }
+
+    int size() const { return int(count_); }
+
+private:
+    size_t capacity_;
+    size_t count_ = 0;
+    DistanceType worst_distance2_;
+    int *indices_;
+    double *distance2_;
+};
+
+/// Collects all points closer than \p max_distance2 into \p neighbors.
+template <typename DistanceType>
+class RadiusResultSet : public flann::ResultSet<DistanceType> {
+public:
+    RadiusResultSet(DistanceType max_distance2,
+                    Neighbors<DistanceType> &neighbors)
+        : max_distance2_(max_distance2), neighbors_(neighbors) {
+        neighbors_.clear();
+    }
+
+    bool full() const override { return true; }
+
+    void addPoint(DistanceType dist, size_t index) override {
+        if (dist < max_distance2_) {
+            neighbors_.emplace_back(dist, index);
+        }
+    }
+
+    DistanceType worstDist() const override { return max_distance2_; }
+
+private:
+    DistanceType max_distance2_;
+    Neighbors<DistanceType> &neighbors_;
+};
+
+/// Counts the points closer than \p max_distance2. Once \p max_count points
+/// are found no distance can beat worstDist(), so the search prunes every
+/// remaining branch.
+template <typename DistanceType>
+class CountResultSet : public flann::ResultSet<DistanceType> {
+public:
+    /// \param indices If not null, receives the indices of the points
+    /// counted.
+    CountResultSet(size_t max_count,
+                   DistanceType max_distance2,
+                   int *indices = nullptr)
+        : max_count_(max_count),
+          worst_distance2_(max_distance2),
+          indices_(indices) {}
+
+    bool full() const override { return true; }
+
+    void addPoint(DistanceType dist, size_t index) override {
+        if (dist >= worst_distance2_) return;
+        if (indices_) indices_[count_] = int(index);
+        if (++count_ >= max_count_) {
+            worst_distance2_ = DistanceType(-1);
+        }
+    }
+
+    DistanceType worstDist() const override { return worst_distance2_; }
+
+    // Reaching max_count_ makes addPoint reject every later point, so
+    // count_ never exceeds max_count_ and indices_ needs exactly max_count_
+    // slots.
+    int size() const { return int(count_); }
+
+private:
+    size_t max_count_;
+    size_t count_ = 0;
+    DistanceType worst_distance2_;
+    int *indices_;
+};
+
+/// Returns a pointer to the query coordinates in the precision of the index,
+/// converting into \p buffer only when the precisions differ.
+template <typename scalar_t, typename T>
+typename std::enable_if<std::is_same<typename T::Scalar, scalar_t>::value,
+                        const scalar_t *>::type
+QueryPtr(const T &query,
+         Eigen::Matrix<scalar_t, T::RowsAtCompileTime, 1> &buffer) {
+    return query.data();
+}
+
+template <typename scalar_t, typename T>
+typename std::enable_if<!std::is_same<typename T::Scalar, scalar_t>::value,
+                        const scalar_t *>::type
+QueryPtr(const T &query,
+         Eigen::Matrix<scalar_t, T::RowsAtCompileTime, 1> &buffer) {
+    buffer = query.template cast<scalar_t>();
+    return buffer.data();
+}
+
+/// Returns a batch of queries in the precision of the index, converting into
+/// \p buffer only when the precisions differ. Query i starts at
+/// i * \p stride.
+const double *QueryBatchPtr(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                            Eigen::MatrixXd &buffer,
+                            size_t &stride) {
+    stride = queries.outerStride();
+    return queries.data();
+}
+
+const float *QueryBatchPtr(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           Eigen::MatrixXf &buffer,
+                           size_t &stride) {
+    buffer = queries.cast<float>();
+    stride = buffer.rows();
+    return buffer.data();
+}
+
+/// The neighbors of a radius search, sorted by distance. The buffer is
+/// reused by all searches of a thread.
+template <typename scalar_t>
+Neighbors<scalar_t> &RadiusNeighborsBuffer() {
+    static thread_local Neighbors<scalar_t> neighbors;
+    return neighbors;
+}
+
+int NumSearchThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+template <typename scalar_t>
+int SearchKNNFlann(const FlannIndex<scalar_t> &index,
+                   const scalar_t *query,
+                   int knn,
+                   int *indices,
+                   double *distance2) {
+    if (knn == 0) {
+        return 0;
+    }
+    KNNResultSet<scalar_t> result(knn, std::numeric_limits<scalar_t>::max(),
+                                  indices, distance2);
+    index.findNeighbors(result, query, flann::SearchParams(-1, 0.0));
+    return result.size();
+}
+
+template <typename scalar_t>
+int SearchHybridFlann(const FlannIndex<scalar_t> &index,
+                      const scalar_t *query,
+                      double radius,
+                      int max_nn,
+                      int *indices,
+                      double *distance2) {
+    if (max_nn == 0) {
+        return 0;
+    }
+    KNNResultSet<scalar_t> result(max_nn, scalar_t(radius * radius), indices,
+                                  distance2);
+    index.findNeighbors(result, query, flann::SearchParams(-1, 0.0));
+    return result.size();
+}
+
+template <typename scalar_t>
+void SearchRadiusFlann(const FlannIndex<scalar_t> &index,
+                       const scalar_t *query,
+                       double radius,
+                       Neighbors<scalar_t> &neighbors) {
+    RadiusResultSet<scalar_t> result(scalar_t(radius * radius), neighbors);
+    index.findNeighbors(result, query, flann::SearchParams(-1, 0.0));
+    std::sort(neighbors.begin(), neighbors.end());
+}
+
+template <typename scalar_t>
+int CountRadiusFlann(const FlannIndex<scalar_t> &index,
+                     const scalar_t *query,
+                     double radius,
+                     int max_count,
+                     int *indices) {
+    CountResultSet<scalar_t> result(
+            max_count > 0 ? size_t(max_count)
+                          : std::numeric_limits<size_t>::max(),
+            scalar_t(radius * radius), indices);
+    index.findNeighbors(result, query, flann::SearchParams(-1, 0.0));
+    return result.size();
+}
+
+template <typename scalar_t>
+int CopyNeighbors(const Neighbors<scalar_t> &neighbors,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) {
+    indices.resize(neighbors.size());
+    distance2.resize(neighbors.size());
+    for (size_t i = 0; i < neighbors.size(); i++) {
+        indices[i] = int(neighbors[i].index_);
+        distance2[i] = double(neighbors[i].dist_);
+    }
+    return int(neighbors.size());
+}
+
+template <typename scalar_t>
+int SearchKNNBatchFlann(const FlannIndex<scalar_t> &index,
+                        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                        int knn,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2) {
+    Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic> query_buffer;
+    size_t stride;
+    const scalar_t *query_data = QueryBatchPtr(queries, query_buffer, stride);
+    const size_t num_queries = queries.cols();
+    indices.resize(num_queries * knn);
+    distance2.resize(num_queries * knn);
+    int total = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : total)
+#endif
+    for (int i = 0; i < int(num_queries); i++) {
+        int *query_indices = indices.data() + i * size_t(knn);
+        double *query_distance2 = distance2.data() + i * size_t(knn);
+        const int k = SearchKNNFlann(index, query_data + i * stride, knn,
+                                     query_indices, query_distance2);
+        std::fill(query_indices + k, query_indices + knn, -1);
+        std::fill(query_distance2 + k, query_distance2 + knn,
+                  std::numeric_limits<double>::infinity());
+        total += k;
+    }
+    return total;
+}
+
+template <typename scalar_t>
+int SearchRadiusBatchFlann(const FlannIndex<scalar_t> &index,
+                           const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) {
+    Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic> query_buffer;
+    size_t stride;
+    const scalar_t *query_data = QueryBatchPtr(queries, query_buffer, stride);
+    const size_t num_queries = queries.cols();
+
+    // Every thread searches a contiguous block of queries into its own
+    // buffers, which are then copied to the block's offset. The first block
+    // is written to the output directly. The result does not depend on the
+    // number of threads.
+    const int num_threads = NumSearchThreads();
+    std::vector<std::vector<int>> thread_indices(num_threads);
+    std::vector<std::vector<double>> thread_distance2(num_threads);
+    std::vector<size_t> thread_begin(num_threads, 0);
+    offsets.assign(num_queries + 1, 0);
+    indices.clear();
+    distance2.clear();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+#ifdef _OPENMP
+        const int thread_id = omp_get_thread_num();
+        const int thread_count = omp_get_num_threads();
+#else
+        const int thread_id = 0;
+        const int thread_count = 1;
+#endif
+        const size_t begin = num_queries * thread_id / thread_count;
+        const size_t end = num_queries * (thread_id + 1) / thread_count;
+        thread_begin[thread_id] = begin;
+        std::vector<int> &block_indices =
+                thread_id == 0 ? indices : thread_indices[thread_id];
+        std::vector<double> &block_distance2 =
+                thread_id == 0 ? distance2 : thread_distance2[thread_id];
+        Neighbors<scalar_t> neighbors;
+        for (size_t i = begin; i < end; i++) {
+            SearchRadiusFlann(index, query_data + i * stride, radius,
+                              neighbors);
+            const size_t block_size = block_indices.size();
+            block_indices.resize(block_size + neighbors.size());
+            block_distance2.resize(block_size + neighbors.size());
+            for (size_t j = 0; j < neighbors.size(); j++) {
+                block_indices[block_size + j] = int(neighbors[j].index_);
+                block_distance2[block_size + j] = double(neighbors[j].dist_);
+            }
+            offsets[i + 1] = neighbors.size();
+        }
+    }
+    for (size_t i = 0; i < num_queries; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets[num_queries]);
+    distance2.resize(offsets[num_queries]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int t = 1; t < num_threads; t++) {
+        const size_t offset = offsets[thread_begin[t]];
+        std::copy(thread_indices[t].begin(), thread_indices[t].end(),
+                  indices.begin() + offset);
+        std::copy(thread_distance2[t].begin(), thread_distance2[t].end(),
+                  distance2.begin() + offset);
+    }
+    return int(offsets[num_queries]);
+}
+
+template <typename scalar_t>
+int SearchHybridBatchFlann(const FlannIndex<scalar_t> &index,
+                           const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           int max_nn,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<int> &counts) {
+    Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic> query_buffer;
+    size_t stride;
+    const scalar_t *query_data = QueryBatchPtr(queries, query_buffer, stride);
+    const size_t num_queries = queries.cols();
+    indices.resize(num_queries * max_nn);
+    distance2.resize(num_queries * max_nn);
+    counts.resize(num_queries);
+    int total = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : total)
+#endif
+    for (int i = 0; i < int(num_queries); i++) {
+        int *query_indices = indices.data() + i * size_t(max_nn);
+        double *query_distance2 = distance2.data() + i * size_t(max_nn);
+        const int k =
+                SearchHybridFlann(index, query_data + i * stride, radius,
+                                  max_nn, query_indices, query_distance2);
+        std::fill(query_indices + k, query_indices + max_nn, -1);
+        std::fill(query_distance2 + k, query_distance2 + max_nn,
+                  std::numeric_limits<double>::infinity());
+        counts[i] = k;
+        total += k;
+    }
+    return total;
+}
+
+}  // unnamed namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
 KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
@@ -55,22 +436,55 @@ KDTreeFlann::~KDTreeFlann() {}
 
 bool KDTreeFlann::SetMatrixData(const Eigen::MatrixXd &data) {
     return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-            data.data(), data.rows(), data.cols()));
+                              data.data(), data.rows(), data.cols()),
+                      false);
 }
 
 bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
+    return SetGeometryData(geometry, false);
+}
+
+bool KDTreeFlann::SetFeature(const registration::Feature &feature) {
+    return SetMatrixData(feature.data_);
+}
+
+bool KDTreeFlann::SetMatrixDataInPlace(const Eigen::MatrixXd &data) {
+    return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+                              data.data(), data.rows(), data.cols()),
+                      true);
+}
+
+bool KDTreeFlann::SetGeometryInPlace(const Geometry &geometry) {
+    return SetGeometryData(geometry, true);
+}
+
+bool KDTreeFlann::SetGeometryData(const Geometry &geometry, bool in_place) {
     switch (geometry.GetGeometryType()) {
         case Geometry::GeometryType::PointCloud:
-            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const PointCloud &)geometry)
-                            .points_.data(),
-                    3, ((const PointCloud &)geometry).points_.size()));
+            return SetRawData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)((const PointCloud &)geometry)
+                                    .points_.data(),
+                            3, ((const PointCloud &)geometry).points_.size()),
+                    in_place);
+        case Geometry::GeometryType::PointCloudFloat:
+            return SetRawData(
+                    Eigen::Map<const Eigen::MatrixXf>(
+                            (const float *)((const PointCloudFloat &)geometry)
+                                    .points_.data(),
+                            3,
+                            ((const PointCloudFloat &)geometry)
+                                    .points_.size()),
+                    in_place);
         case Geometry::GeometryType::TriangleMesh:
         case Geometry::GeometryType::HalfEdgeTriangleMesh:
-            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const TriangleMesh &)geometry)
-                            .vertices_.data(),
-                    3, ((const TriangleMesh &)geometry).vertices_.size()));
+            return SetRawData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)((const TriangleMesh &)geometry)
+                                    .vertices_.data(),
+                            3,
+                            ((const TriangleMesh &)geometry).vertices_.size()),
+                    in_place);
         case Geometry::GeometryType::Image:
         case Geometry::GeometryType::Unspecified:
         default:
@@ -80,10 +494,6 @@ bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
     }
 }
 
-bool KDTreeFlann::SetFeature(const registration::Feature &feature) {
-    return SetMatrixData(feature.data_);
-}
-
 template <typename T>
 int KDTreeFlann::Search(const T &query,
                         const KDTreeSearchParam &param,
@@ -113,48 +523,83 @@ int KDTreeFlann::SearchKNN(const T &query,
                            int knn,
                            std::vector<int> &indices,
                            std::vector<double> &distance2) const {
-    // This is optimized code for heavily repeated search.
-    // Other flann::Index::knnSearch() implementations lose performance due to
-    // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+    // The results are written in place, reusing the vectors for repeated
+    // searches avoids any reallocation.
+    if (knn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
     indices.resize(knn);
     distance2.resize(knn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
-    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
-    indices.resize(k);
-    distance2.resize(k);
+    const int k = SearchKNN(query, knn, indices.data(), distance2.data());
+    indices.resize(std::max(k, 0));
+    distance2.resize(std::max(k, 0));
     return k;
 }
 
+template <typename T>
+int KDTreeFlann::SearchKNN(const T &query,
+                           int knn,
+                           int *indices,
+                           double *distance2) const {
+    if ((!flann_index_ && !flann_index_float_) ||
+        size_t(query.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_buffer;
+        return SearchKNNFlann(*flann_index_float_,
+                              QueryPtr(query, query_buffer), knn, indices,
+                              distance2);
+    }
+    Eigen::Matrix<double, T::RowsAtCompileTime, 1> query_buffer;
+    return SearchKNNFlann(*flann_index_, QueryPtr(query, query_buffer), knn,
+                          indices, distance2);
+}
+
 template <typename T>
 int KDTreeFlann::SearchRadius(const T &query,
                               double radius,
                               std::vector<int> &indices,
                               std::vector<double> &distance2) const {
-    // This is optimized code for heavily repeated search.
-    // Since max_nn is not given, we let flann to do its own memory management.
-    // Other flann::Index::radiusSearch() implementations lose performance due
-    // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    // Since the number of neighbors is not known in advance, they are
+    // collected in a buffer owned by the calling thread and then copied out.
+    if ((!flann_index_ && !flann_index_float_) ||
         size_t(query.rows()) != dimension_) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = -1;
-    std::vector<std::vector<int>> indices_vec(1);
-    std::vector<std::vector<double>> dists_vec(1);
-    int k = flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
-                                       float(radius * radius), param);
-    indices = indices_vec[0];
-    distance2 = dists_vec[0];
-    return k;
+    if (flann_index_float_) {
+        Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_buffer;
+        Neighbors<float> &neighbors = RadiusNeighborsBuffer<float>();
+        SearchRadiusFlann(*flann_index_float_, QueryPtr(query, query_buffer),
+                          radius, neighbors);
+        return CopyNeighbors(neighbors, indices, distance2);
+    }
+    Eigen::Matrix<double, T::RowsAtCompileTime, 1> query_buffer;
+    Neighbors<double> &neighbors = RadiusNeighborsBuffer<double>();
+    SearchRadiusFlann(*flann_index_, QueryPtr(query, query_buffer), radius,
+                      neighbors);
+    return CopyNeighbors(neighbors, indices, distance2);
+}
+
+template <typename T>
+int KDTreeFlann::CountRadius(const T &query,
+                             double radius,
+                             int max_count /* = 0 */,
+                             int *indices /* = nullptr */) const {
+    if ((!flann_index_ && !flann_index_float_) ||
+        size_t(query.rows()) != dimension_ || max_count < 0 ||
+        (indices && max_count == 0)) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_buffer;
+        return CountRadiusFlann(*flann_index_float_,
+                                QueryPtr(query, query_buffer), radius,
+                                max_count, indices);
+    }
+    Eigen::Matrix<double, T::RowsAtCompileTime, 1> query_buffer;
+    return CountRadiusFlann(*flann_index_, QueryPtr(query, query_buffer),
+                            radius, max_count, indices);
 }
 
 template <typename T>
@@ -163,47 +608,135 @@ int KDTreeFlann::SearchHybrid(const T &query,
                               int max_nn,
                               std::vector<int> &indices,
                               std::vector<double> &distance2) const {
-    // This is optimized code for heavily repeated search.
-    // It is also the recommended setting for search.
-    // Other flann::Index::radiusSearch() implementations lose performance due
-    // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || max_nn < 0) {
+    // The results are written in place, reusing the vectors for repeated
+    // searches avoids any reallocation. It is also the recommended setting
+    // for search.
+    if (max_nn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = max_nn;
     indices.resize(max_nn);
     distance2.resize(max_nn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows,
-                                      max_nn);
-    int k = flann_index_->radiusSearch(query_flann, indices_flann, dists_flann,
-                                       float(radius * radius), param);
-    indices.resize(k);
-    distance2.resize(k);
+    const int k = SearchHybrid(query, radius, max_nn, indices.data(),
+                               distance2.data());
+    indices.resize(std::max(k, 0));
+    distance2.resize(std::max(k, 0));
     return k;
 }
 
-bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
+template <typename T>
+int KDTreeFlann::SearchHybrid(const T &query,
+                              double radius,
+                              int max_nn,
+                              int *indices,
+                              double *distance2) const {
+    if ((!flann_index_ && !flann_index_float_) ||
+        size_t(query.rows()) != dimension_ || max_nn < 0) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_buffer;
+        return SearchHybridFlann(*flann_index_float_,
+                                 QueryPtr(query, query_buffer), radius, max_nn,
+                                 indices, distance2);
+    }
+    Eigen::Matrix<double, T::RowsAtCompileTime, 1> query_buffer;
+    return SearchHybridFlann(*flann_index_, QueryPtr(query, query_buffer),
+                             radius, max_nn, indices, distance2);
+}
+
+int KDTreeFlann::SearchKNNBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if ((!flann_index_ && !flann_index_float_) ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        return SearchKNNBatchFlann(*flann_index_float_, queries, knn, indices,
+                                   distance2);
+    }
+    return SearchKNNBatchFlann(*flann_index_, queries, knn, indices,
+                               distance2);
+}
+
+int KDTreeFlann::SearchRadiusBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    if ((!flann_index_ && !flann_index_float_) ||
+        size_t(queries.rows()) != dimension_) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        return SearchRadiusBatchFlann(*flann_index_float_, queries, radius,
+                                      indices, distance2, offsets);
+    }
+    return SearchRadiusBatchFlann(*flann_index_, queries, radius, indices,
+                                  distance2, offsets);
+}
+
+int KDTreeFlann::SearchHybridBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<int> &counts) const {
+    if ((!flann_index_ && !flann_index_float_) ||
+        size_t(queries.rows()) != dimension_ || max_nn < 0) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        return SearchHybridBatchFlann(*flann_index_float_, queries, radius,
+                                      max_nn, indices, distance2, counts);
+    }
+    return SearchHybridBatchFlann(*flann_index_, queries, radius, max_nn,
+                                  indices, distance2, counts);
+}
+
+bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                             bool in_place) {
+    flann_index_.reset();
+    flann_index_float_.reset();
     dimension_ = data.rows();
     dataset_size_ = data.cols();
     if (dimension_ == 0 || dataset_size_ == 0) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
-    data_.resize(dataset_size_ * dimension_);
-    memcpy(data_.data(), data.data(),
-           dataset_size_ * dimension_ * sizeof(double));
-    flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
-                                                   dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
-            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+    // With reordering the index copies the points into tree order while
+    // building, so no other copy is kept. Without it the index searches the
+    // caller's buffer.
+    flann::Matrix<double> dataset((double *)data.data(), dataset_size_,
+                                  dimension_);
+    flann_index_.reset(new FlannIndex<double>(
+            dataset, flann::KDTreeSingleIndexParams(15, !in_place)));
     flann_index_->buildIndex();
     return true;
 }
 
+bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXf> &data,
+                             bool in_place) {
+    flann_index_.reset();
+    flann_index_float_.reset();
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    if (dimension_ == 0 || dataset_size_ == 0) {
+        utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
+        return false;
+    }
+    flann::Matrix<float> dataset((float *)data.data(), dataset_size_,
+                                 dimension_);
+    flann_index_float_.reset(new FlannIndex<float>(
+            dataset, flann::KDTreeSingleIndexParams(15, !in_place)));
+    flann_index_float_->buildIndex();
+    return true;
+}
+
 template int KDTreeFlann::Search<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         const KDTreeSearchParam &param,
@@ -219,12 +752,66 @@ template int KDTreeFlann::SearchRadius<Eigen::Vector3d>(
         double radius,
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
+template int KDTreeFlann::CountRadius<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        double radius,
+        int max_count,
+        int *indices) const;
 template int KDTreeFlann::SearchHybrid<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         double radius,
         int max_nn,
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchKNN<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        int knn,
+        int *indices,
+        double *distance2) const;
+template int KDTreeFlann::SearchHybrid<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        double radius,
+        int max_nn,
+        int *indices,
+        double *distance2) const;
+
+template int KDTreeFlann::Search<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchKNN<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchRadius<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::CountRadius<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        double radius,
+        int max_count,
+        int *indices) const;
+template int KDTreeFlann::SearchHybrid<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchKNN<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        int knn,
+        int *indices,
+        double *distance2) const;
+template int KDTreeFlann::SearchHybrid<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        double radius,
+        int max_nn,
+        int *indices,
+        double *distance2) const;
 
 template int KDTreeFlann::Search<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
@@ -241,12 +828,28 @@ template int KDTreeFlann::SearchRadius<Eigen::VectorXd>(
         double radius,
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
+template int KDTreeFlann::CountRadius<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        double radius,
+        int max_count,
+        int *indices) const;
 template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         double radius,
         int max_nn,
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchKNN<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        int knn,
+        int *indices,
+        double *distance2) const;
+template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        double radius,
+        int max_nn,
+        int *indices,
+        double *distance2) const;
 
 }  // namespace geometry
 }  // namespace open3d
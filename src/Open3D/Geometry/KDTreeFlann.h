@@ -36,11 +36,9 @@
 
 namespace flann {
 template <typename T>
-class Matrix;
-template <typename T>
 struct L2;
-template <typename T>
-class Index;
+template <typename Distance>
+class KDTreeSingleIndex;
 }  // namespace flann
 
 namespace open3d {
@@ -83,6 +81,20 @@ public:
     ///
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const registration::Feature &feature);
+    /// \brief Sets the data for the KDTree from a matrix without copying it.
+    ///
+    /// The KDTree searches \p data directly, so it must outlive the KDTree
+    /// and must not be modified while the KDTree is in use.
+    ///
+    /// \param data Data points for KDTree Construction.
+    bool SetMatrixDataInPlace(const Eigen::MatrixXd &data);
+    /// \brief Sets the data for the KDTree from geometry without copying it.
+    ///
+    /// The same requirements as for SetMatrixDataInPlace apply to the points
+    /// of \p geometry.
+    ///
+    /// \param geometry Geometry for KDTree Construction.
+    bool SetGeometryInPlace(const Geometry &geometry);
 
     template <typename T>
     int Search(const T &query,
@@ -96,12 +108,41 @@ public:
                   std::vector<int> &indices,
                   std::vector<double> &distance2) const;
 
+    /// \brief Searches the \p knn nearest neighbors into caller-owned
+    /// buffers.
+    ///
+    /// \p indices and \p distance2 must hold at least \p knn elements. They
+    /// can be reused across queries, the search itself does not allocate.
+    ///
+    /// \return Number of neighbors found, -1 on invalid input.
+    template <typename T>
+    int SearchKNN(const T &query,
+                  int knn,
+                  int *indices,
+                  double *distance2) const;
+
     template <typename T>
     int SearchRadius(const T &query,
                      double radius,
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Counts the points within \p radius of \p query without
+    /// collecting them.
+    ///
+    /// \param max_count The search stops as soon as \p max_count points are
+    /// found, 0 counts all of them.
+    /// \param indices If not null, receives the indices of the points
+    /// counted, in no particular order. It must hold \p max_count elements,
+    /// which must then be positive.
+    /// \return Number of points found, at most \p max_count if it is
+    /// positive, -1 on invalid input.
+    template <typename T>
+    int CountRadius(const T &query,
+                    double radius,
+                    int max_count = 0,
+                    int *indices = nullptr) const;
+
     template <typename T>
     int SearchHybrid(const T &query,
                      double radius,
@@ -109,17 +150,98 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Searches at most \p max_nn neighbors within \p radius into
+    /// caller-owned buffers.
+    ///
+    /// \p indices and \p distance2 must hold at least \p max_nn elements.
+    /// They can be reused across queries, the search itself does not
+    /// allocate.
+    ///
+    /// \return Number of neighbors found, -1 on invalid input.
+    template <typename T>
+    int SearchHybrid(const T &query,
+                     double radius,
+                     int max_nn,
+                     int *indices,
+                     double *distance2) const;
+
+    /// \brief Searches the \p knn nearest neighbors of a batch of queries.
+    ///
+    /// The queries are processed in parallel and the results are written into
+    /// flat buffers, the neighbors of query \p i are stored at
+    /// [i * knn, (i + 1) * knn) sorted by distance.
+    ///
+    /// \param queries Query points, one per column. A
+    /// std::vector<Eigen::Vector3d> can be passed through an Eigen::Map.
+    /// \param knn Number of neighbors per query.
+    /// \param indices Neighbor indices, -1 when fewer than \p knn points exist.
+    /// \param distance2 Squared distances, infinity for unused entries.
+    /// \return Total number of neighbors found, -1 on invalid input.
+    int SearchKNNBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                       int knn,
+                       std::vector<int> &indices,
+                       std::vector<double> &distance2) const;
+
+    /// \brief Searches the neighbors within \p radius of a batch of queries.
+    ///
+    /// The results are returned in compressed sparse row layout, the
+    /// neighbors of query \p i are stored at [offsets[i], offsets[i + 1])
+    /// sorted by distance.
+    ///
+    /// \param queries Query points, one per column.
+    /// \param radius Search radius.
+    /// \param indices Neighbor indices of all queries.
+    /// \param distance2 Squared distances of all queries.
+    /// \param offsets Row offsets, of size number of queries + 1.
+    /// \return Total number of neighbors found, -1 on invalid input.
+    int SearchRadiusBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                          double radius,
+                          std::vector<int> &indices,
+                          std::vector<double> &distance2,
+                          std::vector<size_t> &offsets) const;
+
+    /// \brief Searches at most \p max_nn neighbors within \p radius of a
+    /// batch of queries.
+    ///
+    /// Uses the same layout as SearchKNNBatch with a stride of \p max_nn,
+    /// the number of neighbors found for query \p i is \p counts[i].
+    ///
+    /// \param queries Query points, one per column.
+    /// \param radius Search radius.
+    /// \param max_nn Maximum number of neighbors per query.
+    /// \param indices Neighbor indices, -1 for unused entries.
+    /// \param distance2 Squared distances, infinity for unused entries.
+    /// \param counts Number of neighbors found per query.
+    /// \return Total number of neighbors found, -1 on invalid input.
+    int SearchHybridBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                          double radius,
+                          int max_nn,
+                          std::vector<int> &indices,
+                          std::vector<double> &distance2,
+                          std::vector<int> &counts) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
     /// Internal method that sets all the members of KDTree by data provided by
-    /// features, geometry, etc.
-    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    /// features, geometry, etc. Unless \p in_place is set, the index keeps its
+    /// own copy of the points in tree order and \p data is only read while
+    /// building.
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                    bool in_place);
+    /// \brief Sets the KDTree data from single-precision data.
+    ///
+    /// Builds a float index, e.g. for PointCloudFloat. Queries of either
+    /// precision are converted to float, distances are returned as double.
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXf> &data,
+                    bool in_place);
+    bool SetGeometryData(const Geometry &geometry, bool in_place);
 
 protected:
-    std::vector<double> data_;
-    std::unique_ptr<flann::Matrix<double>> flann_dataset_;
-    std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    /// Only one of the double and single-precision indices is set at a time.
+    std::unique_ptr<flann::KDTreeSingleIndex<flann::L2<double>>> flann_index_;
+    std::unique_ptr<flann::KDTreeSingleIndex<flann::L2<float>>>
+            flann_index_float_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
@@ -29,12 +29,22 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <numeric>
 
+#include "Open3D/Core/Blob.h"
+#include "Open3D/Core/Tensor.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloudFloat.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Utility/Console.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace geometry {
 
@@ -42,6 +52,8 @@ PointCloud &PointCloud::Clear() {
     points_.clear();
     normals_.clear();
     colors_.clear();
+    width_ = 0;
+    height_ = 0;
     return *this;
 }
 
@@ -112,6 +124,9 @@ PointCloud &PointCloud::operator+=(const PointCloud &cloud) {
     points_.resize(new_vert_num);
     for (size_t i = 0; i < add_vert_num; i++)
         points_[old_vert_num + i] = cloud.points_[i];
+    // Adding to an empty point cloud keeps the layout of the other one.
+    width_ = old_vert_num == 0 ? cloud.width_ : 0;
+    height_ = old_vert_num == 0 ? cloud.height_ : 0;
     return (*this);
 }
 
@@ -142,6 +157,30 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     return distances;
 }
 
+/// Wraps a vector of Eigen::Vector3d as a (N, 3) Float64 Tensor. The Blob has
+/// a no-op deleter since the memory stays owned by the vector.
+static Tensor Vector3dVectorAsTensor(std::vector<Eigen::Vector3d> &vec) {
+    static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+                  "Eigen::Vector3d is expected to be packed.");
+    int64_t num_elements = static_cast<int64_t>(vec.size());
+    void *data_ptr = vec.data();
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), data_ptr,
+                                       [](void *) {});
+    return Tensor({num_elements, 3}, {3, 1}, data_ptr, Dtype::Float64, blob);
+}
+
+Tensor PointCloud::GetPointsTensorView() {
+    return Vector3dVectorAsTensor(points_);
+}
+
+Tensor PointCloud::GetNormalsTensorView() {
+    return Vector3dVectorAsTensor(normals_);
+}
+
+Tensor PointCloud::GetColorsTensorView() {
+    return Vector3dVectorAsTensor(colors_);
+}
+
 PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
                                               bool remove_infinite) {
     bool has_normal = HasNormals();
@@ -171,23 +210,70 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
     return *this;
 }
 
+// helper for SelectByIndex and the outlier removal functions
+namespace {
+
+/// Returns the indices of the nonzero entries of \p mask in increasing order.
+/// Every thread compacts one block of the mask into its slice of the output,
+/// located by a prefix sum of the block counts.
+std::vector<size_t> CompactMask(const std::vector<char> &mask) {
+#ifdef _OPENMP
+    const int num_blocks = omp_get_max_threads();
+#else
+    const int num_blocks = 1;
+#endif
+    const size_t block_size = (mask.size() + num_blocks - 1) / num_blocks;
+    std::vector<size_t> offsets(num_blocks + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        size_t end = std::min(mask.size(), (b + 1) * block_size);
+        size_t count = 0;
+        for (size_t i = b * block_size; i < end; i++) {
+            count += mask[i] != 0;
+        }
+        offsets[b + 1] = count;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<size_t> indices(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        size_t end = std::min(mask.size(), (b + 1) * block_size);
+        size_t k = offsets[b];
+        for (size_t i = b * block_size; i < end; i++) {
+            if (mask[i]) indices[k++] = i;
+        }
+    }
+    return indices;
+}
+
+}  // namespace
+
 std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
         const std::vector<size_t> &indices, bool invert /* = false */) const {
     auto output = std::make_shared<PointCloud>();
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
 
-    std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
+    std::vector<char> mask(points_.size(), invert);
     for (size_t i : indices) {
         mask[i] = !invert;
     }
 
-    for (size_t i = 0; i < points_.size(); i++) {
-        if (mask[i]) {
-            output->points_.push_back(points_[i]);
-            if (has_normals) output->normals_.push_back(normals_[i]);
-            if (has_colors) output->colors_.push_back(colors_[i]);
-        }
+    std::vector<size_t> selected = CompactMask(mask);
+    output->points_.resize(selected.size());
+    if (has_normals) output->normals_.resize(selected.size());
+    if (has_colors) output->colors_.resize(selected.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < int(selected.size()); k++) {
+        output->points_[k] = points_[selected[k]];
+        if (has_normals) output->normals_[k] = normals_[selected[k]];
+        if (has_colors) output->colors_[k] = colors_[selected[k]];
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -206,17 +292,20 @@ public:
           color_(0.0, 0.0, 0.0) {}
 
 public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
+    /// Works for both PointCloud and PointCloudFloat. The sums are always
+    /// accumulated in double precision.
+    template <typename CloudType>
+    void AddPoint(const CloudType &cloud, size_t index) {
+        point_ += cloud.points_[index].template cast<double>();
         if (cloud.HasNormals()) {
             if (!std::isnan(cloud.normals_[index](0)) &&
                 !std::isnan(cloud.normals_[index](1)) &&
                 !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
+                normal_ += cloud.normals_[index].template cast<double>();
             }
         }
         if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
+            color_ += cloud.colors_[index].template cast<double>();
         }
         num_of_points_++;
     }
@@ -238,107 +327,233 @@ public:
     Eigen::Vector3d color_;
 };
 
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
-
-class AccumulatedPointForTrace : public AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
+/// Stable LSD radix sort of \p values by the lowest \p num_bits bits of
+/// \p keys. Digits are up to 16 bits wide, so most voxel grids need one or two
+/// passes. Every pass builds one histogram per contiguous chunk in parallel
+/// and scatters the chunks in order, so the result does not depend on the
+/// number of threads.
+void RadixSortByKey(std::vector<uint64_t> &keys,
+                    std::vector<size_t> &values,
+                    int num_bits) {
+    const int64_t n = int64_t(keys.size());
+#ifdef _OPENMP
+    const int num_chunks = omp_get_max_threads();
+#else
+    const int num_chunks = 1;
+#endif
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    const int num_passes = (num_bits + 15) / 16;
+    if (num_passes == 0) return;
+    const int digit_bits = (num_bits + num_passes - 1) / num_passes;
+    const size_t num_buckets = size_t(1) << digit_bits;
+    const uint64_t digit_mask = num_buckets - 1;
+    std::vector<uint64_t> keys_tmp(n);
+    std::vector<size_t> values_tmp(n);
+    std::vector<size_t> histograms(num_chunks * num_buckets);
+    for (int pass = 0; pass < num_passes; pass++) {
+        const int shift = pass * digit_bits;
+        std::fill(histograms.begin(), histograms.end(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int c = 0; c < num_chunks; c++) {
+            size_t *histogram = histograms.data() + c * num_buckets;
+            const int64_t end = std::min(n, (c + 1) * chunk_size);
+            for (int64_t i = c * chunk_size; i < end; i++) {
+                histogram[(keys[i] >> shift) & digit_mask]++;
             }
         }
-        if (cloud.HasColors()) {
-            if (approximate_class) {
-                auto got = classes.find(int(cloud.colors_[index][0]));
-                if (got == classes.end())
-                    classes[int(cloud.colors_[index][0])] = 1;
-                else
-                    classes[int(cloud.colors_[index][0])] += 1;
-            } else {
-                color_ += cloud.colors_[index];
+        // Offsets in (digit, chunk) order keep the sort stable.
+        size_t offset = 0;
+        for (size_t digit = 0; digit < num_buckets; digit++) {
+            for (int c = 0; c < num_chunks; c++) {
+                size_t count = histograms[c * num_buckets + digit];
+                histograms[c * num_buckets + digit] = offset;
+                offset += count;
             }
         }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
-        num_of_points_++;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int c = 0; c < num_chunks; c++) {
+            size_t *histogram = histograms.data() + c * num_buckets;
+            const int64_t end = std::min(n, (c + 1) * chunk_size);
+            for (int64_t i = c * chunk_size; i < end; i++) {
+                size_t dst = histogram[(keys[i] >> shift) & digit_mask]++;
+                keys_tmp[dst] = keys[i];
+                values_tmp[dst] = values[i];
+            }
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+/// \brief Groups points by the voxel they fall into.
+///
+/// On return, \p points_in_voxel holds the point indices ordered by voxel and,
+/// within a voxel, by point index. The points of voxel v are
+/// points_in_voxel[voxel_offsets[v]] to points_in_voxel[voxel_offsets[v + 1]
+/// - 1]. Voxels are sorted lexicographically by their grid coordinates, so the
+/// grouping is deterministic.
+void GroupPointsByVoxel(const std::vector<Eigen::Vector3i> &voxel_indices,
+                        std::vector<size_t> &points_in_voxel,
+                        std::vector<size_t> &voxel_offsets) {
+    const int64_t n = int64_t(voxel_indices.size());
+    points_in_voxel.resize(n);
+    std::iota(points_in_voxel.begin(), points_in_voxel.end(), 0);
+    voxel_offsets.clear();
+    if (n == 0) {
+        voxel_offsets.push_back(0);
+        return;
     }
 
-    Eigen::Vector3d GetMaxClass() {
-        int max_class = -1;
-        int max_count = -1;
-        for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
-                max_count = it->second;
-                max_class = it->first;
-            }
+    Eigen::Vector3i min_index = voxel_indices[0];
+    Eigen::Vector3i max_index = voxel_indices[0];
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        Eigen::Vector3i local_min = voxel_indices[0];
+        Eigen::Vector3i local_max = voxel_indices[0];
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int64_t i = 0; i < n; i++) {
+            local_min = local_min.cwiseMin(voxel_indices[i]);
+            local_max = local_max.cwiseMax(voxel_indices[i]);
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            min_index = min_index.cwiseMin(local_min);
+            max_index = max_index.cwiseMax(local_max);
         }
-        return Eigen::Vector3d(max_class, max_class, max_class);
     }
+    int bits[3] = {0, 0, 0};
+    for (int d = 0; d < 3; d++) {
+        int64_t range = int64_t(max_index(d)) - int64_t(min_index(d));
+        while (bits[d] < 63 && (int64_t(1) << bits[d]) <= range) {
+            bits[d]++;
+        }
+    }
+    const int num_bits = bits[0] + bits[1] + bits[2];
 
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
+    std::vector<uint64_t> keys;
+    if (num_bits <= 64) {
+        // Pack the offsets from the minimum voxel into one key, ordered x, y,
+        // z from the most significant bits, and radix sort on the used bits.
+        keys.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < n; i++) {
+            Eigen::Vector3i offset = voxel_indices[i] - min_index;
+            keys[i] = (uint64_t(uint32_t(offset(0))) << (bits[1] + bits[2])) |
+                      (uint64_t(uint32_t(offset(1))) << bits[2]) |
+                      uint64_t(uint32_t(offset(2)));
+        }
+        RadixSortByKey(keys, points_in_voxel, num_bits);
+    } else {
+        std::stable_sort(points_in_voxel.begin(), points_in_voxel.end(),
+                         [&voxel_indices](size_t a, size_t b) {
+                             return std::lexicographical_compare(
+                                     voxel_indices[a].data(),
+                                     voxel_indices[a].data() + 3,
+                                     voxel_indices[b].data(),
+                                     voxel_indices[b].data() + 3);
+                         });
+    }
 
-private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
-};
-}  // namespace
+    voxel_offsets.push_back(0);
+    for (int64_t i = 1; i < n; i++) {
+        bool is_new_voxel =
+                keys.empty() ? voxel_indices[points_in_voxel[i]] !=
+                                       voxel_indices[points_in_voxel[i - 1]]
+                             : keys[i] != keys[i - 1];
+        if (is_new_voxel) {
+            voxel_offsets.push_back(i);
+        }
+    }
+    voxel_offsets.push_back(n);
+}
 
-std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
-        double voxel_size) const {
-    auto output = std::make_shared<PointCloud>();
+template <typename CloudType>
+std::shared_ptr<CloudType> VoxelDownSampleImpl(const CloudType &cloud,
+                                               double voxel_size) {
+    typedef typename decltype(CloudType::points_)::value_type Vector3;
+    typedef typename Vector3::Scalar scalar_t;
+    auto output = std::make_shared<CloudType>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelDownSample] voxel_size <= 0.");
     }
     Eigen::Vector3d voxel_size3 =
             Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
-    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
-    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_min_bound = cloud.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = cloud.GetMaxBound() + voxel_size3 * 0.5;
     if (voxel_size * std::numeric_limits<int>::max() <
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+    const int64_t num_points = int64_t(cloud.points_.size());
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord =
+                (cloud.points_[i].template cast<double>() - voxel_min_bound) /
+                voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
                 int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
     }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<size_t> points_in_voxel;
+    std::vector<size_t> voxel_offsets;
+    GroupPointsByVoxel(voxel_indices, points_in_voxel, voxel_offsets);
+
+    const int64_t num_voxels = int64_t(voxel_offsets.size()) - 1;
+    bool has_normals = cloud.HasNormals();
+    bool has_colors = cloud.HasColors();
+    output->points_.resize(num_voxels);
+    if (has_normals) output->normals_.resize(num_voxels);
+    if (has_colors) output->colors_.resize(num_voxels);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t v = 0; v < num_voxels; v++) {
+        AccumulatedPoint accpoint;
+        for (size_t j = voxel_offsets[v]; j < voxel_offsets[v + 1]; j++) {
+            accpoint.AddPoint(cloud, points_in_voxel[j]);
+        }
+        output->points_[v] =
+                accpoint.GetAveragePoint().template cast<scalar_t>();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] =
+                    accpoint.GetAverageNormal().template cast<scalar_t>();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] =
+                    accpoint.GetAverageColor().template cast<scalar_t>();
         }
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
-            (int)points_.size(), (int)output->points_.size());
+            (int)cloud.points_.size(), (int)output->points_.size());
     return output;
 }
+}  // namespace
+
+std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
+        double voxel_size) const {
+    return VoxelDownSampleImpl(*this, voxel_size);
+}
+
+std::shared_ptr<PointCloudFloat> PointCloudFloat::VoxelDownSample(
+        double voxel_size) const {
+    return VoxelDownSampleImpl(*this, voxel_size);
+}
 
 std::tuple<std::shared_ptr<PointCloud>,
            Eigen::MatrixXi,
@@ -360,51 +575,76 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+
+    const int64_t num_points = int64_t(points_.size());
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+    std::vector<int> point_cubic_ids(num_points);
     int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                int(floor(ref_coord(2)));
         int cid = 0;
         for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
+            if ((ref_coord(c) - voxel_indices[i](c)) >= 0.5) {
                 cid += cid_temp[c];
             }
         }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
+        point_cubic_ids[i] = cid;
     }
+    std::vector<size_t> points_in_voxel;
+    std::vector<size_t> voxel_offsets;
+    GroupPointsByVoxel(voxel_indices, points_in_voxel, voxel_offsets);
+
+    const int64_t num_voxels = int64_t(voxel_offsets.size()) - 1;
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    output->points_.resize(num_voxels);
+    if (has_normals) output->normals_.resize(num_voxels);
+    if (has_colors) output->colors_.resize(num_voxels);
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t v = 0; v < num_voxels; v++) {
+        AccumulatedPoint accpoint;
+        // Ordered so that ties between classes resolve to the smallest one.
+        std::map<int, int> classes;
+        original_indices[v].reserve(voxel_offsets[v + 1] - voxel_offsets[v]);
+        for (size_t j = voxel_offsets[v]; j < voxel_offsets[v + 1]; j++) {
+            size_t pid = points_in_voxel[j];
+            accpoint.AddPoint(*this, pid);
+            if (has_colors && approximate_class) {
+                classes[int(colors_[pid][0])]++;
+            }
+            cubic_id(v, point_cubic_ids[pid]) = int(pid);
+            original_indices[v].push_back(int(pid));
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                int max_class = -1;
+                int max_count = -1;
+                for (const auto &it : classes) {
+                    if (it.second > max_count) {
+                        max_count = it.second;
+                        max_class = it.first;
+                    }
+                }
+                output->colors_[v] =
+                        Eigen::Vector3d(max_class, max_class, max_class);
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[v] = accpoint.GetAverageColor();
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
-        }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -424,6 +664,62 @@ std::shared_ptr<PointCloud> PointCloud::UniformDownSample(
     return SelectByIndex(indices);
 }
 
+std::shared_ptr<PointCloud> PointCloud::DownSampleOrganized(
+        int block_size) const {
+    if (!IsOrganized()) {
+        utility::LogError(
+                "[DownSampleOrganized] The point cloud is not organized.");
+    }
+    if (block_size < 1) {
+        utility::LogError("[DownSampleOrganized] Illegal block size.");
+    }
+    auto output = std::make_shared<PointCloud>();
+    output->width_ = (width_ + block_size - 1) / block_size;
+    output->height_ = (height_ + block_size - 1) / block_size;
+    size_t num_blocks = size_t(output->width_) * size_t(output->height_);
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+    output->points_.resize(num_blocks);
+    if (has_normals) output->normals_.resize(num_blocks);
+    if (has_colors) output->colors_.resize(num_blocks);
+    const Eigen::Vector3d invalid =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::quiet_NaN());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int bv = 0; bv < output->height_; bv++) {
+        int v_max = std::min((bv + 1) * block_size, height_);
+        for (int bu = 0; bu < output->width_; bu++) {
+            int u_max = std::min((bu + 1) * block_size, width_);
+            Eigen::Vector3d point_sum = Eigen::Vector3d::Zero();
+            Eigen::Vector3d normal_sum = Eigen::Vector3d::Zero();
+            Eigen::Vector3d color_sum = Eigen::Vector3d::Zero();
+            int num_valid = 0;
+            for (int v = bv * block_size; v < v_max; v++) {
+                for (int u = bu * block_size; u < u_max; u++) {
+                    int i = v * width_ + u;
+                    if (!points_[i].allFinite()) continue;
+                    point_sum += points_[i];
+                    if (has_normals) normal_sum += normals_[i];
+                    if (has_colors) color_sum += colors_[i];
+                    num_valid++;
+                }
+            }
+            int j = bv * output->width_ + bu;
+            if (num_valid == 0) {
+                output->points_[j] = invalid;
+                if (has_normals) output->normals_[j] = invalid;
+                if (has_colors) output->colors_[j] = invalid;
+                continue;
+            }
+            output->points_[j] = point_sum / num_valid;
+            if (has_normals) output->normals_[j] = normal_sum.normalized();
+            if (has_colors) output->colors_[j] = color_sum / num_valid;
+        }
+    }
+    return output;
+}
+
 std::shared_ptr<PointCloud> PointCloud::Crop(
         const AxisAlignedBoundingBox &bbox) const {
     if (bbox.IsEmpty()) {
@@ -452,24 +748,82 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
+    // The neighbors are only compared to nb_points, so the count stops there.
+    // No point has more neighbors than there are points, which also keeps the
+    // limit within int.
+    const int max_count = int(std::min<size_t>(nb_points, points_.size()) + 1);
+    std::vector<char> mask(points_.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
+        int nb_neighbors =
+                kdtree.CountRadius(points_[i], search_radius, max_count);
+        mask[i] = (size_t(nb_neighbors) > nb_points);
     }
+    std::vector<size_t> indices = CompactMask(mask);
+    return std::make_tuple(SelectByIndex(indices), indices);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliersOrganized(size_t nb_points,
+                                          double search_radius,
+                                          int window_radius) const {
+    if (!IsOrganized()) {
+        utility::LogError(
+                "[RemoveRadiusOutliersOrganized] The point cloud is not "
+                "organized.");
+    }
+    if (nb_points < 1 || search_radius <= 0 || window_radius < 1) {
+        utility::LogError(
+                "[RemoveRadiusOutliersOrganized] Illegal input parameters, "
+                "number of points, radius and window radius must be "
+                "positive");
+    }
+    const double search_radius2 = search_radius * search_radius;
+    std::vector<char> mask(points_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < height_; v++) {
+        int v_min = std::max(v - window_radius, 0);
+        int v_max = std::min(v + window_radius, height_ - 1);
+        for (int u = 0; u < width_; u++) {
+            int i = v * width_ + u;
+            if (!points_[i].allFinite()) continue;
+            int u_min = std::max(u - window_radius, 0);
+            int u_max = std::min(u + window_radius, width_ - 1);
+            // Counts the point itself, as the KDTree search does in
+            // RemoveRadiusOutliers, and stops as soon as it is kept.
+            size_t nb_neighbors = 0;
+            for (int nv = v_min; nv <= v_max && nb_neighbors <= nb_points;
+                 nv++) {
+                for (int nu = u_min; nu <= u_max; nu++) {
+                    if ((points_[nv * width_ + nu] - points_[i])
+                                .squaredNorm() <= search_radius2) {
+                        nb_neighbors++;
+                    }
+                }
+            }
+            mask[i] = (nb_neighbors > nb_points);
+        }
+    }
+    auto output = std::make_shared<PointCloud>(*this);
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+    const Eigen::Vector3d invalid =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::quiet_NaN());
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
         if (mask[i]) {
             indices.push_back(i);
+        } else {
+            output->points_[i] = invalid;
+            if (has_normals) output->normals_[i] = invalid;
+            if (has_colors) output->colors_[i] = invalid;
         }
     }
-    return std::make_tuple(SelectByIndex(indices), indices);
+    return std::make_tuple(output, indices);
 }
 
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
@@ -487,23 +841,30 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
     std::vector<double> avg_distances = std::vector<double>(points_.size());
-    std::vector<size_t> indices;
     size_t valid_distances = 0;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel reduction(+ : valid_distances)
 #endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
-        double mean = -1.0;
-        if (dist.size() > 0u) {
-            valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
+    {
+        std::vector<int> tmp_indices(nb_neighbors);
+        std::vector<double> dist(nb_neighbors);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < int(points_.size()); i++) {
+            int k = kdtree.SearchKNN(points_[i], int(nb_neighbors),
+                                     tmp_indices.data(), dist.data());
+            double mean = -1.0;
+            if (k > 0) {
+                valid_distances++;
+                double sum = 0.0;
+                for (int j = 0; j < k; j++) {
+                    sum += std::sqrt(dist[j]);
+                }
+                mean = sum / k;
+            }
+            avg_distances[i] = mean;
         }
-        avg_distances[i] = mean;
     }
     if (valid_distances == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
@@ -522,11 +883,14 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
     // Bessel's correction
     double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
     double distance_threshold = cloud_mean + std_ratio * std_dev;
-    for (size_t i = 0; i < avg_distances.size(); i++) {
-        if (avg_distances[i] > 0 && avg_distances[i] < distance_threshold) {
-            indices.push_back(i);
-        }
+    std::vector<char> mask(avg_distances.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(avg_distances.size()); i++) {
+        mask[i] = avg_distances[i] > 0 && avg_distances[i] < distance_threshold;
     }
+    std::vector<size_t> indices = CompactMask(mask);
     return std::make_tuple(SelectByIndex(indices), indices);
 }
 
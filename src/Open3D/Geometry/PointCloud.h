@@ -36,6 +36,8 @@
 
 namespace open3d {
 
+class Tensor;
+
 namespace camera {
 class PinholeCameraIntrinsic;
 }
@@ -92,6 +94,17 @@ public:
         return points_.size() > 0 && colors_.size() == points_.size();
     }
 
+    /// \brief Returns `true` if the points are laid out on a width_ x height_
+    /// pixel grid.
+    ///
+    /// Point (u, v) is stored at index v * width_ + u, and pixels without a
+    /// valid measurement hold NaN points. Operations that add or remove points
+    /// drop the layout.
+    bool IsOrganized() const {
+        return width_ > 0 && height_ > 0 &&
+               points_.size() == size_t(width_) * size_t(height_);
+    }
+
     /// Normalize point normals to length 1.
     PointCloud &NormalizeNormals() {
         for (size_t i = 0; i < normals_.size(); i++) {
@@ -108,6 +121,23 @@ public:
         return *this;
     }
 
+    /// \brief Returns a (N, 3) Float64 Tensor that views points_ in place.
+    ///
+    /// The Tensor does not own the memory, and writes through it modify the
+    /// point cloud. It is invalidated when points_ is resized or the point
+    /// cloud is destroyed.
+    Tensor GetPointsTensorView();
+
+    /// \brief Returns a (N, 3) Float64 Tensor that views normals_ in place.
+    ///
+    /// See GetPointsTensorView() for the lifetime of the view.
+    Tensor GetNormalsTensorView();
+
+    /// \brief Returns a (N, 3) Float64 Tensor that views colors_ in place.
+    ///
+    /// See GetPointsTensorView() for the lifetime of the view.
+    Tensor GetColorsTensorView();
+
     /// \brief Remove all points fromt he point cloud that have a nan entry, or
     /// infinite entries.
     ///
@@ -131,7 +161,8 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// Normals and colors are averaged if they exist. The output points are
+    /// ordered by the grid coordinates of their voxels.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
@@ -153,6 +184,16 @@ public:
                             const Eigen::Vector3d &max_bound,
                             bool approximate_class = false) const;
 
+    /// \brief Function to downsample an organized point cloud by averaging
+    /// blocks of pixels.
+    ///
+    /// The valid points of every \p block_size x \p block_size block are
+    /// averaged, together with their normals and colors if they exist. The
+    /// output is organized, with NaN points for blocks without valid points.
+    ///
+    /// \param block_size Side of the pixel blocks.
+    std::shared_ptr<PointCloud> DownSampleOrganized(int block_size) const;
+
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// uniformly.
     ///
@@ -187,6 +228,22 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
 
+    /// \brief Function to remove points of an organized point cloud that have
+    /// less than \p nb_points within \p search_radius among the pixels of a
+    /// window.
+    ///
+    /// The removed points are set to NaN so the output keeps the pixel grid.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \param window_radius The window spans 2 * window_radius + 1 pixels on
+    /// each side.
+    /// \return The filtered point cloud and the indices of its valid points.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveRadiusOutliersOrganized(size_t nb_points,
+                                  double search_radius,
+                                  int window_radius = 2) const;
+
     /// \brief Function to remove points that are further away from their
     /// \p nb_neighbor neighbors in average.
     ///
@@ -208,6 +265,23 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of an organized point cloud.
+    ///
+    /// The neighbors of a point are the valid points within
+    /// \p max_neighbor_distance among the pixels of a window around it, so no
+    /// KDTree is built. Invalid pixels get NaN normals. Normals are oriented
+    /// with respect to the input point cloud if normals exist.
+    ///
+    /// \param window_radius The window spans 2 * window_radius + 1 pixels on
+    /// each side.
+    /// \param max_neighbor_distance Neighbors further away from the point, e.g.
+    /// across a depth discontinuity, are ignored.
+    /// \param fast_normal_computation See EstimateNormals().
+    /// \return `false` if the point cloud is not organized.
+    bool EstimateNormalsOrganized(int window_radius = 2,
+                                  double max_neighbor_distance = 0.05,
+                                  bool fast_normal_computation = true);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -281,17 +355,47 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// The hypotheses are scored in parallel, and the iterations stop as soon
+    /// as a sample of inliers has been drawn with the given probability,
+    /// estimated from the best inlier ratio so far.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane,
+    /// 1 runs all iterations.
+    /// \param num_scoring_points If positive, the hypotheses are scored on
+    /// that many random points and the best ones are verified on the whole
+    /// point cloud.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
-    /// the plane inliers.
+    /// the plane inliers, or a zero model and no inliers if no plane could be
+    /// sampled.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            const int num_scoring_points = 0) const;
+
+    /// \brief Segment several planes one after the other, each one from the
+    /// points left by the previous ones, using SegmentPlane.
+    ///
+    /// \param num_planes Maximum number of planes.
+    /// \param min_num_inliers The segmentation stops at the first plane with
+    /// less inliers. It also stops when no plane can be sampled from the
+    /// remaining points.
+    /// \return Returns the plane models and the indices of their inliers, in
+    /// the order they were found.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const int num_planes,
+                  const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const double probability = 0.99999999,
+                  const int num_scoring_points = 0,
+                  const size_t min_num_inliers = 0) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -310,8 +414,9 @@ public:
     /// \Return An empty pointcloud if the conversion fails.
     /// If \param project_valid_depth_only is true, return point cloud, which
     /// doesn't
-    /// have nan point. If the value is false, return point cloud, which has
-    /// a point for each pixel, whereas invalid depth results in NaN points.
+    /// have nan point. If the value is false, return an organized point cloud,
+    /// which has a point for each pixel, whereas invalid depth results in NaN
+    /// points.
     static std::shared_ptr<PointCloud> CreateFromDepthImage(
             const Image &depth,
             const camera::PinholeCameraIntrinsic &intrinsic,
@@ -335,8 +440,9 @@ public:
     /// \Return An empty pointcloud if the conversion fails.
     /// If \param project_valid_depth_only is true, return point cloud, which
     /// doesn't
-    /// have nan point. If the value is false, return point cloud, which has
-    /// a point for each pixel, whereas invalid depth results in NaN points.
+    /// have nan point. If the value is false, return an organized point cloud,
+    /// which has a point for each pixel, whereas invalid depth results in NaN
+    /// points.
     static std::shared_ptr<PointCloud> CreateFromRGBDImage(
             const RGBDImage &image,
             const camera::PinholeCameraIntrinsic &intrinsic,
@@ -352,6 +458,14 @@ public:
     std::shared_ptr<PointCloud> CreateFromVoxelGrid(
             const VoxelGrid &voxel_grid);
 
+    /// \brief Factory function to create a PointCloud from a (N, 3) Tensor.
+    ///
+    /// The values are copied into points_ with a single Tensor copy through
+    /// GetPointsTensorView(). The Tensor may have any dtype and device.
+    ///
+    /// \param points The (N, 3) Tensor of point coordinates.
+    static std::shared_ptr<PointCloud> CreateFromTensor(const Tensor &points);
+
 public:
     /// RGB colors of points.
     std::vector<Eigen::Vector3d> points_;
@@ -359,6 +473,10 @@ public:
     std::vector<Eigen::Vector3d> normals_;
     /// Points coordinates.
     std::vector<Eigen::Vector3d> colors_;
+    /// Width of the pixel grid of an organized point cloud, 0 otherwise.
+    int width_ = 0;
+    /// Height of the pixel grid of an organized point cloud, 0 otherwise.
+    int height_ = 0;
 };
 
 }  // namespace geometry
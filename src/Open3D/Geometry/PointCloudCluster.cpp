@@ -27,7 +27,12 @@
 #include "Open3D/Geometry/PointCloud.h"
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Utility/Console.h"
@@ -39,82 +44,476 @@
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
+namespace {
+
+/// Disjoint sets that can be merged from several threads at once. Every set
+/// is rooted at its smallest element, so a parent never exceeds its child and
+/// the roots do not depend on the order of the merges.
+class ConcurrentDisjointSet {
+public:
+    explicit ConcurrentDisjointSet(size_t size) : parent_(size) {
+        for (size_t i = 0; i < size; i++) {
+            parent_[i].store(int(i), std::memory_order_relaxed);
+        }
+    }
 
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
+    int Find(int i) {
+        while (true) {
+            int p = parent_[i].load(std::memory_order_relaxed);
+            if (p == i) return i;
+            // Path halving, skipped if another thread got there first.
+            int gp = parent_[p].load(std::memory_order_relaxed);
+            if (p != gp) parent_[i].compare_exchange_weak(p, gp);
+            i = gp;
+        }
+    }
+
+    void Union(int i, int j) {
+        while (true) {
+            i = Find(i);
+            j = Find(j);
+            if (i == j) return;
+            if (i < j) std::swap(i, j);
+            // Link the larger root below the smaller one, unless i stopped
+            // being a root in the meantime.
+            int expected = i;
+            if (parent_[i].compare_exchange_strong(expected, j)) return;
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+/// Numbers the clusters of core points by their first point and labels the
+/// core points with them. The other points are labeled -1.
+std::vector<int> LabelCorePoints(const std::vector<char> &is_core,
+                                 ConcurrentDisjointSet &clusters) {
+    const int n = int(is_core.size());
+    std::vector<int> labels(n, -1);
+    int cluster_label = 0;
+    for (int i = 0; i < n; i++) {
+        if (is_core[i] && clusters.Find(i) == i) {
+            labels[i] = cluster_label++;
+        }
+    }
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+    for (int i = 0; i < n; i++) {
+        if (!is_core[i]) continue;
+        int root = clusters.Find(i);
+        if (root != i) labels[i] = labels[root];
+    }
+    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    return labels;
+}
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { ++progress_bar; }
+/// Squared distance in the summation order of the FLANN L2 distance, so that
+/// both neighbor searches agree on the boundary.
+inline double Distance2(const Eigen::Vector3d &p, const Eigen::Vector3d &q) {
+    double d0 = p(0) - q(0);
+    double d1 = p(1) - q(1);
+    double d2 = p(2) - q(2);
+    return d0 * d0 + d1 * d1 + d2 * d2;
+}
+
+/// The points bucketed into a hashed grid of cubes small enough that any two
+/// points of a cube are neighbors. Points that are not finite are left out.
+class DBSCANGrid {
+public:
+    /// Bits per cell coordinate in a cell key.
+    static const int kCoordinateBits = 21;
+
+    struct Cell {
+        Eigen::Vector3i coordinate;
+        /// Range of the points of the cell in points_ and indices_.
+        int begin;
+        int end;
+    };
+
+    /// The cell keys of the finite points and their indices, sorted by key.
+    static std::vector<std::pair<uint64_t, int>> SortByCell(
+            const std::vector<Eigen::Vector3d> &points,
+            double eps,
+            const Eigen::Vector3d &min_bound) {
+        const double side = CellSide(eps);
+        std::vector<std::pair<uint64_t, int>> keys;
+        keys.reserve(points.size());
+        for (size_t i = 0; i < points.size(); i++) {
+            if (!points[i].allFinite()) continue;
+            keys.emplace_back(Key(CellCoordinate(points[i], side, min_bound)),
+                              int(i));
+        }
+        std::sort(keys.begin(), keys.end());
+        return keys;
     }
-    utility::LogDebug("Done Precompute Neighbours");
 
-    // set all labels to undefined (-2)
-    utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
+    /// \param keys The output of SortByCell.
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points,
+               const std::vector<std::pair<uint64_t, int>> &keys,
+               double eps,
+               const Eigen::Vector3d &min_bound)
+        : eps2_(eps * eps) {
+        const double side = CellSide(eps);
+        points_.resize(keys.size());
+        indices_.resize(keys.size());
+        for (size_t k = 0; k < keys.size(); k++) {
+            indices_[k] = keys[k].second;
+            points_[k] = points[indices_[k]];
+            if (k == 0 || keys[k].first != keys[k - 1].first) {
+                cell_map_[keys[k].first] = int(cells_.size());
+                cells_.push_back(
+                        Cell{CellCoordinate(points_[k], side, min_bound),
+                             int(k), int(k)});
+            }
+            cells_.back().end = int(k) + 1;
         }
 
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+        // Offsets of the cells that can hold points within eps of a cell.
+        for (int dx = -2; dx <= 2; dx++) {
+            for (int dy = -2; dy <= 2; dy++) {
+                for (int dz = -2; dz <= 2; dz++) {
+                    Eigen::Vector3i gap(std::max(std::abs(dx) - 1, 0),
+                                        std::max(std::abs(dy) - 1, 0),
+                                        std::max(std::abs(dz) - 1, 0));
+                    if (gap.squaredNorm() * side * side < eps2_) {
+                        offsets_.push_back(Eigen::Vector3i(dx, dy, dz));
+                    }
+                }
+            }
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
+    /// The occupied cells that can hold neighbors of cell \p c, itself
+    /// included.
+    void NeighborCells(int c, std::vector<int> &neighbor_cells) const {
+        const int max_coordinate = (1 << kCoordinateBits) - 1;
+        neighbor_cells.clear();
+        for (const auto &offset : offsets_) {
+            Eigen::Vector3i coordinate = cells_[c].coordinate + offset;
+            if (coordinate.minCoeff() < 0 ||
+                coordinate.maxCoeff() > max_coordinate) {
+                continue;
+            }
+            auto it = cell_map_.find(Key(coordinate));
+            if (it != cell_map_.end()) neighbor_cells.push_back(it->second);
+        }
+    }
 
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
+    /// Calls \p func on the neighbors of point \p k in \p neighbor_cells
+    /// until it returns false.
+    template <typename Func>
+    void ForEachNeighbor(int k,
+                         const std::vector<int> &neighbor_cells,
+                         Func func) const {
+        for (int c : neighbor_cells) {
+            for (int l = cells_[c].begin; l < cells_[c].end; l++) {
+                if (Distance2(points_[k], points_[l]) < eps2_ && !func(l)) {
+                    return;
+                }
+            }
+        }
+    }
 
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
+    /// Whether a point of cell \p c0 and a point of cell \p c1 passing
+    /// \p filter are neighbors.
+    template <typename Filter>
+    bool HasNeighbors(int c0, int c1, Filter filter) const {
+        for (int k = cells_[c0].begin; k < cells_[c0].end; k++) {
+            if (!filter(k)) continue;
+            for (int l = cells_[c1].begin; l < cells_[c1].end; l++) {
+                if (filter(l) && Distance2(points_[k], points_[l]) < eps2_) {
+                    return true;
+                }
             }
-            if (labels[nb] != -2) {  // not undefined label
+        }
+        return false;
+    }
+
+    /// The diagonal of a cell is eps, shrunk a little so that rounding cannot
+    /// put two points eps apart in the same cell.
+    static double CellSide(double eps) {
+        return eps / std::sqrt(3.0) * (1.0 - 1e-12);
+    }
+
+    static Eigen::Vector3i CellCoordinate(const Eigen::Vector3d &point,
+                                          double side,
+                                          const Eigen::Vector3d &min_bound) {
+        return ((point - min_bound) / side).array().floor().cast<int>();
+    }
+
+    static uint64_t Key(const Eigen::Vector3i &coordinate) {
+        return (uint64_t(coordinate(0)) << (2 * kCoordinateBits)) |
+               (uint64_t(coordinate(1)) << kCoordinateBits) |
+               uint64_t(coordinate(2));
+    }
+
+    std::vector<Cell> cells_;
+    /// The points sorted by cell, and their indices in the point cloud.
+    std::vector<Eigen::Vector3d> points_;
+    std::vector<int> indices_;
+
+private:
+    double eps2_;
+    std::unordered_map<uint64_t, int> cell_map_;
+    std::vector<Eigen::Vector3i> offsets_;
+};
+
+/// DBSCAN on a grid: the cells with at least min_points points only hold core
+/// points, and the core points of a cell form one cluster, so the neighbor
+/// searches are left to the sparse cells and the clusters are merged cell by
+/// cell.
+std::vector<int> ClusterDBSCANOnGrid(const DBSCANGrid &grid,
+                                     size_t num_points,
+                                     size_t min_points,
+                                     bool print_progress) {
+    utility::ConsoleProgressBar progress_bar(3, "Clustering", print_progress);
+    const int num_cells = int(grid.cells_.size());
+    const std::vector<int> &indices = grid.indices_;
+
+    utility::LogDebug("Find Core Points");
+    std::vector<char> is_core(num_points, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> neighbor_cells;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int c = 0; c < num_cells; c++) {
+            const DBSCANGrid::Cell &cell = grid.cells_[c];
+            if (size_t(cell.end - cell.begin) >= min_points) {
+                for (int k = cell.begin; k < cell.end; k++) {
+                    is_core[indices[k]] = 1;
+                }
                 continue;
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+            grid.NeighborCells(c, neighbor_cells);
+            for (int k = cell.begin; k < cell.end; k++) {
+                size_t count = 0;
+                grid.ForEachNeighbor(k, neighbor_cells, [&](int l) {
+                    return ++count < min_points;
+                });
+                is_core[indices[k]] = count >= min_points;
+            }
+        }
+    }
+    ++progress_bar;
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
-                    }
+    utility::LogDebug("Merge Core Points");
+    ConcurrentDisjointSet clusters(num_points);
+    auto is_core_k = [&](int k) { return is_core[indices[k]] != 0; };
+    // The first core point of every cell, -1 if there is none.
+    std::vector<int> first_core(num_cells, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_cells; c++) {
+        const DBSCANGrid::Cell &cell = grid.cells_[c];
+        for (int k = cell.begin; k < cell.end; k++) {
+            if (!is_core_k(k)) continue;
+            if (first_core[c] < 0) {
+                first_core[c] = k;
+            } else {
+                clusters.Union(indices[first_core[c]], indices[k]);
+            }
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> neighbor_cells;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int c = 0; c < num_cells; c++) {
+            if (first_core[c] < 0) continue;
+            grid.NeighborCells(c, neighbor_cells);
+            // Every pair of cells is seen from both ends, merge it from the
+            // smaller one.
+            for (int nb : neighbor_cells) {
+                if (nb <= c || first_core[nb] < 0) continue;
+                int i = indices[first_core[c]];
+                int j = indices[first_core[nb]];
+                if (clusters.Find(i) != clusters.Find(j) &&
+                    grid.HasNeighbors(c, nb, is_core_k)) {
+                    clusters.Union(i, j);
                 }
             }
         }
+    }
+    ++progress_bar;
 
-        cluster_label++;
+    utility::LogDebug("Label Points");
+    std::vector<int> labels = LabelCorePoints(is_core, clusters);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> neighbor_cells;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int c = 0; c < num_cells; c++) {
+            const DBSCANGrid::Cell &cell = grid.cells_[c];
+            neighbor_cells.clear();
+            for (int k = cell.begin; k < cell.end; k++) {
+                if (is_core_k(k)) continue;
+                if (neighbor_cells.empty()) {
+                    grid.NeighborCells(c, neighbor_cells);
+                }
+                int label = -1;
+                grid.ForEachNeighbor(k, neighbor_cells, [&](int l) {
+                    int nb_label = labels[indices[l]];
+                    if (is_core_k(l) && (label == -1 || nb_label < label)) {
+                        label = nb_label;
+                    }
+                    return true;
+                });
+                labels[indices[k]] = label;
+            }
+        }
     }
+    ++progress_bar;
+    return labels;
+}
 
-    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+/// DBSCAN with radius searches in a KDTreeFlann, merging the clusters of
+/// adjacent core points.
+std::vector<int> ClusterDBSCANWithKDTree(const PointCloud &pcd,
+                                         double eps,
+                                         size_t min_points,
+                                         bool print_progress) {
+    utility::ConsoleProgressBar progress_bar(3, "Clustering", print_progress);
+    const int n = int(pcd.points_.size());
+    KDTreeFlann kdtree(pcd);
+
+    // The points that are not core points have less than min_points
+    // neighbors. Those are kept for labeling the border points, in one
+    // buffer per block of points.
+    utility::LogDebug("Find Core Points");
+    const int kBlockSize = 4096;
+    const int num_blocks = (n + kBlockSize - 1) / kBlockSize;
+    const int max_nn = std::max(int(min_points), 1);
+    std::vector<char> is_core(n);
+    std::vector<int> nbs_begin(n, 0);
+    std::vector<int> nbs_count(n, 0);
+    std::vector<std::vector<int>> block_nbs(num_blocks);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nbs(max_nn);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_blocks; b++) {
+            int end = std::min(n, (b + 1) * kBlockSize);
+            for (int i = b * kBlockSize; i < end; i++) {
+                int k = kdtree.CountRadius(pcd.points_[i], eps, max_nn,
+                                           nbs.data());
+                is_core[i] = k >= int(min_points);
+                if (is_core[i] || k <= 0) continue;
+                nbs_begin[i] = int(block_nbs[b].size());
+                nbs_count[i] = k;
+                block_nbs[b].insert(block_nbs[b].end(), nbs.begin(),
+                                    nbs.begin() + k);
+            }
+        }
+    }
+    ++progress_bar;
+
+    utility::LogDebug("Merge Core Points");
+    ConcurrentDisjointSet clusters(n);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nbs;
+        std::vector<double> nbs_dists2;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int i = 0; i < n; i++) {
+            if (!is_core[i]) continue;
+            kdtree.SearchRadius(pcd.points_[i], eps, nbs, nbs_dists2);
+            // Every edge is seen from both ends, merge it from the larger
+            // one.
+            for (int j : nbs) {
+                if (j < i && is_core[j]) clusters.Union(i, j);
+            }
+        }
+    }
+    ++progress_bar;
+
+    utility::LogDebug("Label Points");
+    std::vector<int> labels = LabelCorePoints(is_core, clusters);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; i++) {
+        if (is_core[i]) continue;
+        const int *nbs = block_nbs[i / kBlockSize].data() + nbs_begin[i];
+        int label = -1;
+        for (int k = 0; k < nbs_count[i]; k++) {
+            int j = nbs[k];
+            if (is_core[j] && (label == -1 || labels[j] < label)) {
+                label = labels[j];
+            }
+        }
+        labels[i] = label;
+    }
+    ++progress_bar;
     return labels;
 }
 
+}  // namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    if (points_.empty()) return std::vector<int>();
+
+    // A core point can join the clusters of its core neighbors in any order,
+    // and a border point joins the first adjacent cluster, the clusters being
+    // numbered by their first core point. This gives the same labels as
+    // expanding the clusters one after the other in point order.
+    //
+    // The grid needs the cell coordinates to fit in a key, and pays off when
+    // eps is small enough relative to the extent of the cloud to leave it
+    // many cells, each with a few points at least. Sparser clouds are left
+    // to the KDTree.
+    const double kMinPointsPerCell = 2.0;
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound = -min_bound;
+    for (const auto &point : points_) {
+        if (!point.allFinite()) continue;
+        min_bound = min_bound.cwiseMin(point);
+        max_bound = max_bound.cwiseMax(point);
+    }
+    double cells_per_axis =
+            (max_bound - min_bound).maxCoeff() / eps * std::sqrt(3.0);
+    if (eps > 0.0 &&
+        cells_per_axis < double(1 << DBSCANGrid::kCoordinateBits) - 4.0) {
+        auto keys = DBSCANGrid::SortByCell(points_, eps, min_bound);
+        size_t num_cells = 0;
+        for (size_t k = 0; k < keys.size(); k++) {
+            num_cells += k == 0 || keys[k].first != keys[k - 1].first;
+        }
+        if (double(keys.size()) >= kMinPointsPerCell * double(num_cells)) {
+            utility::LogDebug("Cluster on a grid");
+            return ClusterDBSCANOnGrid(
+                    DBSCANGrid(points_, keys, eps, min_bound), points_.size(),
+                    min_points, print_progress);
+        }
+    }
+    utility::LogDebug("Cluster with a KDTree");
+    return ClusterDBSCANWithKDTree(*this, eps, min_points, print_progress);
+}
+
 }  // namespace geometry
 }  // namespace open3d
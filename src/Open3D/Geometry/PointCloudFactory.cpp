@@ -28,6 +28,7 @@
 #include <limits>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Core/Tensor.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
@@ -62,8 +63,9 @@ std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
     auto principal_point = intrinsic.GetPrincipalPoint();
     int num_valid_pixels;
     if (!project_valid_depth_only) {
-        num_valid_pixels =
-                int(depth.height_ / stride) * int(depth.width_ / stride);
+        pointcloud->width_ = (depth.width_ + stride - 1) / stride;
+        pointcloud->height_ = (depth.height_ + stride - 1) / stride;
+        num_valid_pixels = pointcloud->width_ * pointcloud->height_;
     } else {
         num_valid_pixels = CountValidDepthPixels(depth, stride);
     }
@@ -104,6 +106,8 @@ std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
     double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
     int num_valid_pixels;
     if (!project_valid_depth_only) {
+        pointcloud->width_ = image.depth_.width_;
+        pointcloud->height_ = image.depth_.height_;
         num_valid_pixels = image.depth_.height_ * image.depth_.width_;
     } else {
         num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
@@ -215,5 +219,19 @@ std::shared_ptr<PointCloud> PointCloud::CreateFromVoxelGrid(
     return output;
 }
 
+std::shared_ptr<PointCloud> PointCloud::CreateFromTensor(
+        const Tensor &points) {
+    if (points.NumDims() != 2 || points.GetShape(1) != 3) {
+        utility::LogError(
+                "[CreateFromTensor] points must have shape (N, 3), but got "
+                "{}.",
+                points.GetShape().ToString());
+    }
+    auto output = std::make_shared<PointCloud>();
+    output->points_.resize(points.GetShape(0));
+    output->GetPointsTensorView().AsRvalue() = points;
+    return output;
+}
+
 }  // namespace geometry
 }  // namespace open3d
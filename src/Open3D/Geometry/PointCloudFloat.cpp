@@ -0,0 +1,277 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloudFloat.h"
+
+#include <Eigen/Dense>
+#include <cmath>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+PointCloudFloat &PointCloudFloat::Clear() {
+    points_.clear();
+    normals_.clear();
+    colors_.clear();
+    return *this;
+}
+
+bool PointCloudFloat::IsEmpty() const { return !HasPoints(); }
+
+Eigen::Vector3d PointCloudFloat::GetMinBound() const {
+    if (points_.empty()) {
+        return Eigen::Vector3d(0.0, 0.0, 0.0);
+    }
+    Eigen::Vector3f min_bound = points_[0];
+    for (const auto &point : points_) {
+        min_bound = min_bound.cwiseMin(point);
+    }
+    return min_bound.cast<double>();
+}
+
+Eigen::Vector3d PointCloudFloat::GetMaxBound() const {
+    if (points_.empty()) {
+        return Eigen::Vector3d(0.0, 0.0, 0.0);
+    }
+    Eigen::Vector3f max_bound = points_[0];
+    for (const auto &point : points_) {
+        max_bound = max_bound.cwiseMax(point);
+    }
+    return max_bound.cast<double>();
+}
+
+Eigen::Vector3d PointCloudFloat::GetCenter() const {
+    Eigen::Vector3d center(0, 0, 0);
+    if (points_.empty()) {
+        return center;
+    }
+    for (const auto &point : points_) {
+        center += point.cast<double>();
+    }
+    return center / double(points_.size());
+}
+
+AxisAlignedBoundingBox PointCloudFloat::GetAxisAlignedBoundingBox() const {
+    return AxisAlignedBoundingBox(GetMinBound(), GetMaxBound());
+}
+
+OrientedBoundingBox PointCloudFloat::GetOrientedBoundingBox() const {
+    // The PCA of the bounding box is not performance critical, so the points
+    // are promoted to double to reuse the PointCloud implementation.
+    std::vector<Eigen::Vector3d> points(points_.size());
+    for (size_t i = 0; i < points_.size(); i++) {
+        points[i] = points_[i].cast<double>();
+    }
+    return OrientedBoundingBox::CreateFromPoints(points);
+}
+
+PointCloudFloat &PointCloudFloat::Transform(
+        const Eigen::Matrix4d &transformation) {
+    const Eigen::Matrix4f transformation_f = transformation.cast<float>();
+    for (auto &point : points_) {
+        Eigen::Vector4f new_point =
+                transformation_f *
+                Eigen::Vector4f(point(0), point(1), point(2), 1.0f);
+        point = new_point.head<3>() / new_point(3);
+    }
+    for (auto &normal : normals_) {
+        normal = transformation_f.block<3, 3>(0, 0) * normal;
+    }
+    return *this;
+}
+
+PointCloudFloat &PointCloudFloat::Translate(const Eigen::Vector3d &translation,
+                                            bool relative) {
+    Eigen::Vector3d transform = translation;
+    if (!relative) {
+        transform -= GetCenter();
+    }
+    const Eigen::Vector3f transform_f = transform.cast<float>();
+    for (auto &point : points_) {
+        point += transform_f;
+    }
+    return *this;
+}
+
+PointCloudFloat &PointCloudFloat::Scale(const double scale, bool center) {
+    Eigen::Vector3f points_center(0, 0, 0);
+    if (center && !points_.empty()) {
+        points_center = GetCenter().cast<float>();
+    }
+    const float scale_f = float(scale);
+    for (auto &point : points_) {
+        point = (point - points_center) * scale_f + points_center;
+    }
+    return *this;
+}
+
+PointCloudFloat &PointCloudFloat::Rotate(const Eigen::Matrix3d &R,
+                                         bool center) {
+    Eigen::Vector3f points_center(0, 0, 0);
+    if (center && !points_.empty()) {
+        points_center = GetCenter().cast<float>();
+    }
+    const Eigen::Matrix3f R_f = R.cast<float>();
+    for (auto &point : points_) {
+        point = R_f * (point - points_center) + points_center;
+    }
+    for (auto &normal : normals_) {
+        normal = R_f * normal;
+    }
+    return *this;
+}
+
+PointCloudFloat &PointCloudFloat::NormalizeNormals() {
+    for (size_t i = 0; i < normals_.size(); i++) {
+        normals_[i].normalize();
+    }
+    return *this;
+}
+
+PointCloudFloat &PointCloudFloat::PaintUniformColor(
+        const Eigen::Vector3d &color) {
+    std::vector<Eigen::Vector3d> colors;
+    ResizeAndPaintUniformColor(colors, 1, color);
+    colors_.assign(points_.size(), colors[0].cast<float>());
+    return *this;
+}
+
+PointCloudFloat &PointCloudFloat::RemoveNonFinitePoints(bool remove_nan,
+                                                        bool remove_infinite) {
+    bool has_normal = HasNormals();
+    bool has_color = HasColors();
+    size_t old_point_num = points_.size();
+    size_t k = 0;                                 // new index
+    for (size_t i = 0; i < old_point_num; i++) {  // old index
+        bool is_nan = remove_nan &&
+                      (std::isnan(points_[i](0)) || std::isnan(points_[i](1)) ||
+                       std::isnan(points_[i](2)));
+        bool is_infinite = remove_infinite && (std::isinf(points_[i](0)) ||
+                                               std::isinf(points_[i](1)) ||
+                                               std::isinf(points_[i](2)));
+        if (!is_nan && !is_infinite) {
+            points_[k] = points_[i];
+            if (has_normal) normals_[k] = normals_[i];
+            if (has_color) colors_[k] = colors_[i];
+            k++;
+        }
+    }
+    points_.resize(k);
+    if (has_normal) normals_.resize(k);
+    if (has_color) colors_.resize(k);
+    utility::LogDebug(
+            "[RemoveNonFinitePoints] {:d} nan points have been removed.",
+            (int)(old_point_num - k));
+    return *this;
+}
+
+std::shared_ptr<PointCloudFloat> PointCloudFloat::SelectByIndex(
+        const std::vector<size_t> &indices, bool invert /* = false */) const {
+    auto output = std::make_shared<PointCloudFloat>();
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+
+    std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
+    for (size_t i : indices) {
+        mask[i] = !invert;
+    }
+
+    for (size_t i = 0; i < points_.size(); i++) {
+        if (mask[i]) {
+            output->points_.push_back(points_[i]);
+            if (has_normals) output->normals_.push_back(normals_[i]);
+            if (has_colors) output->colors_.push_back(colors_[i]);
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)points_.size(), (int)output->points_.size());
+    return output;
+}
+
+std::shared_ptr<PointCloudFloat> PointCloudFloat::Crop(
+        const AxisAlignedBoundingBox &bbox) const {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[CropPointCloud] AxisAlignedBoundingBox either has zeros "
+                "size, or has wrong bounds.");
+    }
+    // Compare in float so that points on the box faces are kept.
+    const Eigen::Vector3f min_bound = bbox.min_bound_.cast<float>();
+    const Eigen::Vector3f max_bound = bbox.max_bound_.cast<float>();
+    std::vector<size_t> indices;
+    for (size_t idx = 0; idx < points_.size(); idx++) {
+        const auto &point = points_[idx];
+        if (point(0) >= min_bound(0) && point(0) <= max_bound(0) &&
+            point(1) >= min_bound(1) && point(1) <= max_bound(1) &&
+            point(2) >= min_bound(2) && point(2) <= max_bound(2)) {
+            indices.push_back(idx);
+        }
+    }
+    return SelectByIndex(indices);
+}
+
+std::shared_ptr<PointCloudFloat> PointCloudFloat::CreateFromPointCloud(
+        const PointCloud &cloud) {
+    auto output = std::make_shared<PointCloudFloat>();
+    output->points_.resize(cloud.points_.size());
+    for (size_t i = 0; i < cloud.points_.size(); i++) {
+        output->points_[i] = cloud.points_[i].cast<float>();
+    }
+    output->normals_.resize(cloud.normals_.size());
+    for (size_t i = 0; i < cloud.normals_.size(); i++) {
+        output->normals_[i] = cloud.normals_[i].cast<float>();
+    }
+    output->colors_.resize(cloud.colors_.size());
+    for (size_t i = 0; i < cloud.colors_.size(); i++) {
+        output->colors_[i] = cloud.colors_[i].cast<float>();
+    }
+    return output;
+}
+
+std::shared_ptr<PointCloud> PointCloudFloat::ToPointCloud() const {
+    auto output = std::make_shared<PointCloud>();
+    output->points_.resize(points_.size());
+    for (size_t i = 0; i < points_.size(); i++) {
+        output->points_[i] = points_[i].cast<double>();
+    }
+    output->normals_.resize(normals_.size());
+    for (size_t i = 0; i < normals_.size(); i++) {
+        output->normals_[i] = normals_[i].cast<double>();
+    }
+    output->colors_.resize(colors_.size());
+    for (size_t i = 0; i < colors_.size(); i++) {
+        output->colors_[i] = colors_[i].cast<double>();
+    }
+    return output;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry3D.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class PointCloudFloat
+///
+/// \brief A point cloud with single-precision points, normals and colors.
+///
+/// PointCloudFloat stores 12 bytes per attribute per point instead of the 24
+/// bytes of PointCloud, halving the memory footprint and bandwidth of large
+/// scans. Accumulations, e.g. voxel averages and normal covariances, are still
+/// computed in double precision.
+class PointCloudFloat : public Geometry3D {
+public:
+    /// \brief Default Constructor.
+    PointCloudFloat() : Geometry3D(Geometry::GeometryType::PointCloudFloat) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param points Points coordinates.
+    PointCloudFloat(const std::vector<Eigen::Vector3f> &points)
+        : Geometry3D(Geometry::GeometryType::PointCloudFloat),
+          points_(points) {}
+    ~PointCloudFloat() override {}
+
+public:
+    PointCloudFloat &Clear() override;
+    bool IsEmpty() const override;
+    Eigen::Vector3d GetMinBound() const override;
+    Eigen::Vector3d GetMaxBound() const override;
+    Eigen::Vector3d GetCenter() const override;
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const override;
+    OrientedBoundingBox GetOrientedBoundingBox() const override;
+    PointCloudFloat &Transform(const Eigen::Matrix4d &transformation) override;
+    PointCloudFloat &Translate(const Eigen::Vector3d &translation,
+                               bool relative = true) override;
+    PointCloudFloat &Scale(const double scale, bool center = true) override;
+    PointCloudFloat &Rotate(const Eigen::Matrix3d &R,
+                            bool center = true) override;
+
+    /// Returns 'true' if the point cloud contains points.
+    bool HasPoints() const { return points_.size() > 0; }
+
+    /// Returns `true` if the point cloud contains point normals.
+    bool HasNormals() const {
+        return points_.size() > 0 && normals_.size() == points_.size();
+    }
+
+    /// Returns `true` if the point cloud contains point colors.
+    bool HasColors() const {
+        return points_.size() > 0 && colors_.size() == points_.size();
+    }
+
+    /// Normalize point normals to length 1.
+    PointCloudFloat &NormalizeNormals();
+
+    /// Assigns each point in the PointCloudFloat the same color.
+    ///
+    /// \param color  RGB colors of points.
+    PointCloudFloat &PaintUniformColor(const Eigen::Vector3d &color);
+
+    /// \brief Remove all points from the point cloud that have a nan entry, or
+    /// infinite entries.
+    ///
+    /// Also removes the corresponding normals and color entries.
+    ///
+    /// \param remove_nan Remove NaN values from the PointCloudFloat.
+    /// \param remove_infinite Remove infinite values from the PointCloudFloat.
+    PointCloudFloat &RemoveNonFinitePoints(bool remove_nan = true,
+                                           bool remove_infinite = true);
+
+    /// \brief Function to select points from \p input pointcloud into
+    /// \p output pointcloud.
+    ///
+    /// \param indices Indices of points to be selected.
+    /// \param invert Set to `True` to invert the selection of indices.
+    std::shared_ptr<PointCloudFloat> SelectByIndex(
+            const std::vector<size_t> &indices, bool invert = false) const;
+
+    /// \brief Function to downsample input pointcloud into output pointcloud
+    /// with a voxel.
+    ///
+    /// Normals and colors are averaged if they exist.
+    ///
+    /// \param voxel_size Defines the resolution of the voxel grid,
+    /// smaller value leads to denser output point cloud.
+    std::shared_ptr<PointCloudFloat> VoxelDownSample(double voxel_size) const;
+
+    /// \brief Function to crop pointcloud into output pointcloud
+    ///
+    /// All points with coordinates outside the bounding box \p bbox are
+    /// clipped.
+    ///
+    /// \param bbox AxisAlignedBoundingBox to crop points.
+    std::shared_ptr<PointCloudFloat> Crop(
+            const AxisAlignedBoundingBox &bbox) const;
+
+    /// \brief Function to compute the normals of a point cloud.
+    ///
+    /// Normals are oriented with respect to the input point cloud if normals
+    /// exist. The neighbors are searched in a single-precision KDTreeFlann.
+    ///
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search. \param fast_normal_computation If true, the normal estiamtion
+    /// uses a non-iterative method to extract the eigenvector from the
+    /// covariance matrix. This is faster, but is not as numerical stable.
+    bool EstimateNormals(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
+            bool fast_normal_computation = true);
+
+    /// \brief Factory function to create a PointCloudFloat from a PointCloud.
+    ///
+    /// \param cloud The double precision point cloud.
+    static std::shared_ptr<PointCloudFloat> CreateFromPointCloud(
+            const PointCloud &cloud);
+
+    /// Returns a double precision copy of the point cloud.
+    std::shared_ptr<PointCloud> ToPointCloud() const;
+
+public:
+    /// Points coordinates.
+    std::vector<Eigen::Vector3f> points_;
+    /// Points normals.
+    std::vector<Eigen::Vector3f> normals_;
+    /// RGB colors of points.
+    std::vector<Eigen::Vector3f> colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
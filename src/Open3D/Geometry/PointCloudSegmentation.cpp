@@ -28,10 +28,12 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <random>
-#include <unordered_set>
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
@@ -47,42 +49,109 @@ public:
     RANSACResult() : fitness_(0), inlier_rmse_(0) {}
     ~RANSACResult() {}
 
+    /// More inliers, or as many and closer to the model.
+    bool IsBetterThan(const RANSACResult &other) const {
+        return fitness_ > other.fitness_ ||
+               (fitness_ == other.fitness_ &&
+                inlier_rmse_ < other.inlier_rmse_);
+    }
+
 public:
     double fitness_;
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
-    RANSACResult result;
+namespace {
+
+/// \class PlaneCandidates
+///
+/// \brief Points that a plane is fit to, with their coordinates stored in
+/// separate arrays so that the distances to a plane are computed with SIMD
+/// instructions.
+class PlaneCandidates {
+public:
+    /// \param indices The candidates, as indices into \p points.
+    PlaneCandidates(const std::vector<Eigen::Vector3d> &points,
+                    const std::vector<size_t> &indices)
+        : indices_(indices),
+          x_(indices.size()),
+          y_(indices.size()),
+          z_(indices.size()) {
+        for (size_t i = 0; i < indices.size(); i++) {
+            x_[i] = points[indices[i]](0);
+            y_[i] = points[indices[i]](1);
+            z_[i] = points[indices[i]](2);
+        }
+    }
+
+    size_t Size() const { return indices_.size(); }
+
+    // Calculates the number of inliers given a plane model, and the total
+    // distance between the inliers and the plane. These numbers are then used
+    // to evaluate how well the plane model fits the points.
+    RANSACResult Evaluate(const Eigen::Vector4d &plane_model,
+                          double distance_threshold) const {
+        const double a = plane_model(0), b = plane_model(1),
+                     c = plane_model(2), d = plane_model(3);
+        const double *x = x_.data(), *y = y_.data(), *z = z_.data();
+        const int n = int(Size());
+        int inlier_num = 0;
+        double error = 0.0;
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : inlier_num, error)
+#endif
+        for (int i = 0; i < n; i++) {
+            double distance = std::abs(a * x[i] + b * y[i] + c * z[i] + d);
+            bool inlier = distance < distance_threshold;
+            inlier_num += inlier;
+            error += inlier ? distance : 0.0;
+        }
 
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
+        RANSACResult result;
+        if (inlier_num > 0) {
+            result.fitness_ = double(inlier_num) / double(n);
+            result.inlier_rmse_ = error / std::sqrt(double(inlier_num));
+        }
+        return result;
+    }
 
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
+    /// Returns the inliers of \p plane_model, as indices into the points.
+    std::vector<size_t> Inliers(const Eigen::Vector4d &plane_model,
+                                double distance_threshold) const {
+        std::vector<size_t> inliers;
+        for (size_t i = 0; i < Size(); i++) {
+            double distance =
+                    std::abs(plane_model(0) * x_[i] + plane_model(1) * y_[i] +
+                             plane_model(2) * z_[i] + plane_model(3));
+            if (distance < distance_threshold) {
+                inliers.push_back(indices_[i]);
+            }
         }
+        return inliers;
     }
 
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
+private:
+    const std::vector<size_t> &indices_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+};
+
+/// Returns the number of iterations after which a sample of \p ransac_n
+/// inliers has been drawn with \p probability, for the given inlier ratio.
+int RequiredRANSACIterations(double inlier_ratio,
+                             int ransac_n,
+                             double probability) {
+    const double outlier_sample_probability =
+            1.0 - std::pow(inlier_ratio, ransac_n);
+    if (probability >= 1.0 || outlier_sample_probability >= 1.0) {
+        return std::numeric_limits<int>::max();
     }
-    return result;
+    if (outlier_sample_probability <= 0.0) return 1;
+    double iterations = std::ceil(std::log(1.0 - probability) /
+                                  std::log(outlier_sample_probability));
+    return int(std::min(iterations,
+                        double(std::numeric_limits<int>::max())));
 }
 
 // Find the plane such that the summed squared distance from the
@@ -133,86 +202,182 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
+/// RANSAC plane fit to the points \p indices of \p points. Returns the plane
+/// model and its inliers, as indices into \p points.
+///
+/// The hypotheses are drawn in batches, one after the other so that the
+/// result does not depend on the number of threads, and are scored in
+/// parallel. When \p num_scoring_points is smaller than the number of
+/// candidates, the hypotheses are scored on that many random candidates and
+/// the best one of every batch is verified on all of them.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &indices,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        int num_scoring_points,
+        std::mt19937 &rng) {
+    const int kBatchSize = 32;
+    const PlaneCandidates candidates(points, indices);
+
+    // The samples are drawn by partial Fisher-Yates shuffles of the pool, so
+    // its first num_scoring_points entries are a random subsample once the
+    // first samples are drawn.
+    std::vector<size_t> pool(indices);
+    auto sample = [&](int sample_size) {
+        for (int i = 0; i < sample_size; i++) {
+            std::swap(pool[i], pool[i + rng() % (pool.size() - i)]);
+        }
+    };
+    std::vector<size_t> scoring_indices;
+    std::unique_ptr<PlaneCandidates> scoring_subsample;
+    if (num_scoring_points > 0 && size_t(num_scoring_points) < pool.size()) {
+        sample(num_scoring_points);
+        scoring_indices.assign(pool.begin(),
+                               pool.begin() + num_scoring_points);
+        scoring_subsample.reset(new PlaneCandidates(points, scoring_indices));
+    }
+    const PlaneCandidates &scoring =
+            scoring_subsample ? *scoring_subsample : candidates;
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
+    RANSACResult result;
+    // Initialize the best plane model ax + by + cz + d = 0.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+    std::vector<Eigen::Vector4d> plane_models(kBatchSize);
+    std::vector<RANSACResult> results(kBatchSize);
+    int max_iterations = num_iterations;
+    int itr = 0;
+    while (itr < max_iterations) {
+        const int batch_size = std::min(kBatchSize, max_iterations - itr);
+        for (int k = 0; k < batch_size; k++) {
+            // Fit model to num_model_parameters randomly selected points.
+            sample(ransac_n);
+            plane_models[k] = TriangleMesh::ComputeTrianglePlane(
+                    points[pool[0]], points[pool[1]], points[pool[2]]);
+        }
+        itr += batch_size;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < batch_size; k++) {
+            results[k] = plane_models[k].isZero(0)
+                                 ? RANSACResult()
+                                 : scoring.Evaluate(plane_models[k],
+                                                    distance_threshold);
+        }
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
+        int best_k = 0;
+        for (int k = 1; k < batch_size; k++) {
+            if (results[k].IsBetterThan(results[best_k])) best_k = k;
+        }
+        if (results[best_k].fitness_ == 0) continue;
+        RANSACResult this_result =
+                scoring_subsample ? candidates.Evaluate(plane_models[best_k],
+                                                        distance_threshold)
+                                  : results[best_k];
+        if (this_result.IsBetterThan(result)) {
+            result = this_result;
+            best_plane_model = plane_models[best_k];
+            max_iterations = std::min(
+                    max_iterations,
+                    RequiredRANSACIterations(result.fitness_, ransac_n,
+                                             probability));
+        }
+    }
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+    // No plane was ever sampled, e.g. from collinear or duplicate points: the
+    // zero model would be at distance 0 of every point.
+    if (best_plane_model.isZero(0)) {
+        utility::LogDebug("RANSAC | No plane found, Iteration: {:d}", itr);
+        return std::make_tuple(best_plane_model, std::vector<size_t>());
+    }
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    // Find the final inliers using best_plane_model, and improve
+    // best_plane_model using them.
+    std::vector<size_t> inliers =
+            candidates.Inliers(best_plane_model, distance_threshold);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
+
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iteration: "
+            "{:d}",
+            inliers.size(), result.fitness_, result.inlier_rmse_, itr);
+    return std::make_tuple(best_plane_model, inliers);
+}
 
-    // Return if ransac_n is less than the required plane model parameters.
+void CheckSegmentPlaneParameters(size_t num_points,
+                                 int ransac_n,
+                                 double probability) {
     if (ransac_n < 3) {
         utility::LogError(
                 "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
     }
     if (num_points < size_t(ransac_n)) {
         utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
     }
+    if (probability <= 0.0 || probability > 1.0) {
+        utility::LogError("probability must be in (0, 1].");
+    }
+}
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+}  // namespace
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
-        }
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */,
+        const int num_scoring_points /* = 0 */) const {
+    CheckSegmentPlaneParameters(points_.size(), ransac_n, probability);
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
-        }
-    }
+    std::vector<size_t> indices(points_.size());
+    std::iota(std::begin(indices), std::end(indices), 0);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return SegmentPlaneRANSAC(points_, indices, distance_threshold, ransac_n,
+                              num_iterations, probability, num_scoring_points,
+                              rng);
+}
 
-    // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
-                              1);
-        double distance = std::abs(best_plane_model.dot(point));
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const int num_planes,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const double probability /* = 0.99999999 */,
+                          const int num_scoring_points /* = 0 */,
+                          const size_t min_num_inliers /* = 0 */) const {
+    CheckSegmentPlaneParameters(points_.size(), ransac_n, probability);
 
-        if (distance < distance_threshold) {
-            inliers.emplace_back(idx);
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    for (int p = 0; p < num_planes; p++) {
+        if (remaining.size() < std::max(size_t(ransac_n), min_num_inliers)) {
+            break;
         }
-    }
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = SegmentPlaneRANSAC(
+                points_, remaining, distance_threshold, ransac_n,
+                num_iterations, probability, num_scoring_points, rng);
+        if (inliers.empty() || inliers.size() < min_num_inliers) break;
 
-    // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
-
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
-    return std::make_tuple(best_plane_model, inliers);
+        // Both are sorted, the inliers being taken from the remaining points
+        // in order.
+        std::vector<size_t> outliers;
+        outliers.reserve(remaining.size() - inliers.size());
+        std::set_difference(remaining.begin(), remaining.end(),
+                            inliers.begin(), inliers.end(),
+                            std::back_inserter(outliers));
+        remaining.swap(outliers);
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    return planes;
 }
 
 }  // namespace geometry
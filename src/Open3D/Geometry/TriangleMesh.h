@@ -250,12 +250,12 @@ public:
     /// (Two or more faces connected only by a vertex and not by an edge.)
     bool IsVertexManifold() const;
 
-    /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// Function that returns the pairs of triangles that intersect each other
+    /// and share no vertex, sorted. Only the triangles whose bounding boxes
+    /// overlap, found with a TriangleMeshBVH, are tested.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -263,7 +263,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests the triangles of the smaller mesh against those of a
+    /// TriangleMeshBVH of the larger one.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
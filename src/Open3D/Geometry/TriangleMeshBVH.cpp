@@ -0,0 +1,541 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Hierarchies are made of leaves of at most kMaxLeafSize triangles.
+const int kMaxLeafSize = 4;
+/// Number of bins per axis in which the splits are evaluated.
+const int kNumBins = 16;
+/// Below this depth splits minimize the surface area heuristic, beyond it
+/// they halve the triangles, which bounds the depth by
+/// kMaxSAHDepth + 32 < TriangleMeshBVH::kMaxDepth.
+const int kMaxSAHDepth = 64;
+/// Subtrees with more triangles are built in a separate task.
+const int kMinParallelBuildSize = 4096;
+
+double SurfaceArea(const Eigen::AlignedBox3d &box) {
+    if (box.isEmpty()) return 0;
+    const Eigen::Vector3d d = box.sizes();
+    return d(0) * d(1) + d(1) * d(2) + d(2) * d(0);
+}
+
+/// Sets the bounds of \p node to the smallest single precision box that
+/// contains \p box.
+void SetBounds(TriangleMeshBVH::Node &node, const Eigen::AlignedBox3d &box) {
+    const float inf = std::numeric_limits<float>::infinity();
+    for (int i = 0; i < 3; i++) {
+        float lo = static_cast<float>(box.min()(i));
+        float hi = static_cast<float>(box.max()(i));
+        if (lo > box.min()(i)) lo = std::nextafter(lo, -inf);
+        if (hi < box.max()(i)) hi = std::nextafter(hi, inf);
+        node.min_bound_(i) = lo;
+        node.max_bound_(i) = hi;
+    }
+}
+
+/// Builds the hierarchy in a preallocated array of 2n - 1 nodes, where the
+/// subtree over n triangles rooted at node i takes the nodes i to
+/// i + 2n - 2, its first child rooted at i + 1 and its second one at
+/// i + 2 n_first + 1. Disjoint subtrees are then built concurrently.
+class BVHBuilder {
+public:
+    BVHBuilder(const std::vector<Eigen::Vector3d> &vertices,
+               const std::vector<Eigen::Vector3i> &triangles)
+        : boxes_(triangles.size()),
+          centroids_(triangles.size()),
+          order_(triangles.size()),
+          nodes_(2 * triangles.size() - 1) {
+        for (size_t i = 0; i < triangles.size(); i++) {
+            const Eigen::Vector3d &v0 = vertices[triangles[i](0)];
+            const Eigen::Vector3d &v1 = vertices[triangles[i](1)];
+            const Eigen::Vector3d &v2 = vertices[triangles[i](2)];
+            boxes_[i] = Eigen::AlignedBox3d(v0.cwiseMin(v1).cwiseMin(v2),
+                                            v0.cwiseMax(v1).cwiseMax(v2));
+            centroids_[i] = boxes_[i].center();
+        }
+        std::iota(order_.begin(), order_.end(), 0);
+    }
+
+    void Build() {
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+        Build(0, 0, int(order_.size()), 0);
+    }
+
+    /// Moves the nodes to depth-first order, where the first child of every
+    /// inner node follows it.
+    std::vector<TriangleMeshBVH::Node> GetNodes() const {
+        std::vector<TriangleMeshBVH::Node> nodes;
+        nodes.reserve(nodes_.size());
+        Flatten(0, nodes);
+        return nodes;
+    }
+
+    const std::vector<int> &GetOrder() const { return order_; }
+
+private:
+    void Build(int node, int begin, int end, int depth) {
+        Eigen::AlignedBox3d box, centroid_box;
+        for (int k = begin; k < end; k++) {
+            box.extend(boxes_[order_[k]]);
+            centroid_box.extend(centroids_[order_[k]]);
+        }
+        SetBounds(nodes_[node], box);
+        const int n = end - begin;
+        if (n <= kMaxLeafSize) {
+            nodes_[node].offset_ = begin;
+            nodes_[node].num_triangles_ = n;
+            return;
+        }
+
+        int mid = begin;
+        int axis = 0, split = 0;
+        if (depth < kMaxSAHDepth && FindSplit(begin, end, centroid_box, axis,
+                                                 split)) {
+            const double lo = centroid_box.min()(axis);
+            const double scale = kNumBins / centroid_box.sizes()(axis);
+            mid = int(std::partition(order_.begin() + begin,
+                                     order_.begin() + end,
+                                     [&](int i) {
+                                         return Bin(centroids_[i](axis), lo,
+                                                    scale) < split;
+                                     }) -
+                      order_.begin());
+        }
+        if (mid == begin || mid == end) {
+            // Either too deep or all centroids in one bin: halve.
+            centroid_box.sizes().maxCoeff(&axis);
+            mid = begin + n / 2;
+            std::nth_element(order_.begin() + begin, order_.begin() + mid,
+                             order_.begin() + end, [&](int i, int j) {
+                                 return centroids_[i](axis) <
+                                        centroids_[j](axis);
+                             });
+        }
+
+        const int second = node + 2 * (mid - begin);
+        nodes_[node].offset_ = second;
+        nodes_[node].num_triangles_ = 0;
+#ifdef _OPENMP
+#pragma omp task if (n > kMinParallelBuildSize)
+#endif
+        Build(node + 1, begin, mid, depth + 1);
+        Build(second, mid, end, depth + 1);
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+    }
+
+    static int Bin(double c, double lo, double scale) {
+        return std::min(int((c - lo) * scale), kNumBins - 1);
+    }
+
+    /// Finds the axis and the bin before which splitting the triangles has
+    /// the lowest surface area heuristic cost.
+    bool FindSplit(int begin,
+                   int end,
+                   const Eigen::AlignedBox3d &centroid_box,
+                   int &best_axis,
+                   int &best_split) const {
+        double best_cost = std::numeric_limits<double>::infinity();
+        for (int axis = 0; axis < 3; axis++) {
+            const double extent = centroid_box.sizes()(axis);
+            if (!(extent > 0)) continue;
+            const double lo = centroid_box.min()(axis);
+            const double scale = kNumBins / extent;
+            Eigen::AlignedBox3d bin_boxes[kNumBins];
+            int bin_counts[kNumBins] = {0};
+            for (int k = begin; k < end; k++) {
+                const int i = order_[k];
+                const int b = Bin(centroids_[i](axis), lo, scale);
+                bin_boxes[b].extend(boxes_[i]);
+                bin_counts[b]++;
+            }
+            // Cost of the bins on the left of every split.
+            double left_costs[kNumBins];
+            Eigen::AlignedBox3d left;
+            int left_count = 0;
+            for (int b = 0; b < kNumBins - 1; b++) {
+                left.extend(bin_boxes[b]);
+                left_count += bin_counts[b];
+                left_costs[b + 1] = left_count * SurfaceArea(left);
+            }
+            Eigen::AlignedBox3d right;
+            int right_count = 0;
+            for (int b = kNumBins - 1; b > 0; b--) {
+                right.extend(bin_boxes[b]);
+                right_count += bin_counts[b];
+                const double cost =
+                        left_costs[b] + right_count * SurfaceArea(right);
+                if (right_count < end - begin && right_count > 0 &&
+                    cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b;
+                }
+            }
+        }
+        return best_cost < std::numeric_limits<double>::infinity();
+    }
+
+    void Flatten(int node, std::vector<TriangleMeshBVH::Node> &nodes) const {
+        const size_t index = nodes.size();
+        nodes.push_back(nodes_[node]);
+        if (nodes_[node].IsLeaf()) return;
+        Flatten(node + 1, nodes);
+        nodes[index].offset_ = int(nodes.size());
+        Flatten(nodes_[node].offset_, nodes);
+    }
+
+    std::vector<Eigen::AlignedBox3d> boxes_;
+    std::vector<Eigen::Vector3d> centroids_;
+    std::vector<int> order_;
+    std::vector<TriangleMeshBVH::Node> nodes_;
+};
+
+double SquaredDistanceToNode(const TriangleMeshBVH::Node &node,
+                             const Eigen::Vector3d &p) {
+    double d2 = 0;
+    for (int i = 0; i < 3; i++) {
+        const double d = std::max(
+                {0.0, node.min_bound_(i) - p(i), p(i) - node.max_bound_(i)});
+        d2 += d * d;
+    }
+    return d2;
+}
+
+Eigen::Vector3d ClosestPointOnSegment(const Eigen::Vector3d &p,
+                                      const Eigen::Vector3d &a,
+                                      const Eigen::Vector3d &b) {
+    const Eigen::Vector3d ab = b - a;
+    const double l2 = ab.squaredNorm();
+    if (l2 == 0) return a;
+    return a + std::min(std::max((p - a).dot(ab) / l2, 0.0), 1.0) * ab;
+}
+
+/// Closest point on the triangle abc, from the Voronoi regions of its
+/// vertices and edges (Ericson, Real-Time Collision Detection, 5.1.5).
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &a,
+                                       const Eigen::Vector3d &b,
+                                       const Eigen::Vector3d &c) {
+    const Eigen::Vector3d ab = b - a;
+    const Eigen::Vector3d ac = c - a;
+    const Eigen::Vector3d ap = p - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) return a;
+
+    const Eigen::Vector3d bp = p - b;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) return b;
+
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        return a + d1 / (d1 - d3) * ab;
+    }
+
+    const Eigen::Vector3d cp = p - c;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) return c;
+
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        return a + d2 / (d2 - d6) * ac;
+    }
+
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+    }
+
+    const double sum = va + vb + vc;
+    if (!(sum > 0)) {
+        // Degenerate triangle: closest point on its edges.
+        Eigen::Vector3d best = ClosestPointOnSegment(p, a, b);
+        for (const Eigen::Vector3d &q :
+             {ClosestPointOnSegment(p, b, c), ClosestPointOnSegment(p, c, a)}) {
+            if ((q - p).squaredNorm() < (best - p).squaredNorm()) best = q;
+        }
+        return best;
+    }
+    return a + vb / sum * ab + vc / sum * ac;
+}
+
+/// Ray and triangle intersection (Moller and Trumbore).
+bool RayTriangle(const Eigen::Vector3d &origin,
+                 const Eigen::Vector3d &direction,
+                 const Eigen::Vector3d &a,
+                 const Eigen::Vector3d &b,
+                 const Eigen::Vector3d &c,
+                 double &t) {
+    const Eigen::Vector3d e1 = b - a;
+    const Eigen::Vector3d e2 = c - a;
+    const Eigen::Vector3d pvec = direction.cross(e2);
+    const double det = e1.dot(pvec);
+    if (det == 0) return false;
+    const double inv_det = 1.0 / det;
+    const Eigen::Vector3d tvec = origin - a;
+    const double u = tvec.dot(pvec) * inv_det;
+    if (u < 0 || u > 1) return false;
+    const Eigen::Vector3d qvec = tvec.cross(e1);
+    const double v = direction.dot(qvec) * inv_det;
+    if (v < 0 || u + v > 1) return false;
+    t = e2.dot(qvec) * inv_det;
+    return true;
+}
+
+/// Ray and box intersection with the slab test. Divisions by zero produce
+/// NaNs that std::min and std::max drop in favour of the other argument.
+bool RayNode(const TriangleMeshBVH::Node &node,
+             const Eigen::Vector3d &origin,
+             const Eigen::Vector3d &inv_direction,
+             double max_t) {
+    double t0 = 0;
+    double t1 = max_t;
+    for (int i = 0; i < 3; i++) {
+        const double ta = (node.min_bound_(i) - origin(i)) * inv_direction(i);
+        const double tb = (node.max_bound_(i) - origin(i)) * inv_direction(i);
+        t0 = std::max(t0, std::min(ta, tb));
+        t1 = std::min(t1, std::max(ta, tb));
+    }
+    return t0 <= t1;
+}
+
+bool ShareVertex(const Eigen::Vector3i &p, const Eigen::Vector3i &q) {
+    for (int i = 0; i < 3; i++) {
+        if (p(i) == q(0) || p(i) == q(1) || p(i) == q(2)) return true;
+    }
+    return false;
+}
+
+}  // unnamed namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh) {
+    SetGeometry(mesh);
+}
+
+bool TriangleMeshBVH::SetGeometry(const TriangleMesh &mesh) {
+    nodes_.clear();
+    vertices_.clear();
+    triangles_.clear();
+    triangle_indices_.clear();
+    if (mesh.triangles_.empty()) {
+        utility::LogWarning(
+                "[TriangleMeshBVH::SetGeometry] Failed due to no triangles.");
+        return false;
+    }
+    const int num_vertices = int(mesh.vertices_.size());
+    for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+        if (triangle.minCoeff() < 0 || triangle.maxCoeff() >= num_vertices) {
+            utility::LogWarning(
+                    "[TriangleMeshBVH::SetGeometry] Failed due to invalid "
+                    "vertex index.");
+            return false;
+        }
+    }
+
+    BVHBuilder builder(mesh.vertices_, mesh.triangles_);
+    builder.Build();
+    nodes_ = builder.GetNodes();
+    vertices_ = mesh.vertices_;
+    triangle_indices_ = builder.GetOrder();
+    triangles_.resize(triangle_indices_.size());
+    for (size_t k = 0; k < triangle_indices_.size(); k++) {
+        triangles_[k] = mesh.triangles_[triangle_indices_[k]];
+    }
+    return true;
+}
+
+double TriangleMeshBVH::ClosestPoint(const Eigen::Vector3d &query,
+                                     Eigen::Vector3d &closest_point,
+                                     int &triangle) const {
+    if (nodes_.empty()) return -1;
+    double best_d2 = std::numeric_limits<double>::infinity();
+    int stack[kMaxDepth + 1];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const int n = stack[--top];
+        const Node &node = nodes_[n];
+        if (SquaredDistanceToNode(node, query) >= best_d2) continue;
+        if (!node.IsLeaf()) {
+            // Visit the nearest child first.
+            int first = n + 1;
+            int second = node.offset_;
+            if (SquaredDistanceToNode(nodes_[second], query) <
+                SquaredDistanceToNode(nodes_[first], query)) {
+                std::swap(first, second);
+            }
+            stack[top++] = second;
+            stack[top++] = first;
+            continue;
+        }
+        for (int k = node.offset_; k < node.offset_ + node.num_triangles_;
+             k++) {
+            const Eigen::Vector3d p = ClosestPointOnTriangle(
+                    query, vertices_[triangles_[k](0)],
+                    vertices_[triangles_[k](1)], vertices_[triangles_[k](2)]);
+            const double d2 = (p - query).squaredNorm();
+            if (d2 < best_d2) {
+                best_d2 = d2;
+                closest_point = p;
+                triangle = triangle_indices_[k];
+            }
+        }
+    }
+    return std::sqrt(best_d2);
+}
+
+bool TriangleMeshBVH::RayCast(const Eigen::Vector3d &origin,
+                              const Eigen::Vector3d &direction,
+                              double &t,
+                              int &triangle,
+                              double max_t) const {
+    if (nodes_.empty()) return false;
+    const Eigen::Vector3d inv_direction = direction.cwiseInverse();
+    bool hit = false;
+    int stack[kMaxDepth + 1];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const int n = stack[--top];
+        const Node &node = nodes_[n];
+        if (!RayNode(node, origin, inv_direction, max_t)) continue;
+        if (!node.IsLeaf()) {
+            stack[top++] = node.offset_;
+            stack[top++] = n + 1;
+            continue;
+        }
+        for (int k = node.offset_; k < node.offset_ + node.num_triangles_;
+             k++) {
+            double tk;
+            if (RayTriangle(origin, direction, vertices_[triangles_[k](0)],
+                            vertices_[triangles_[k](1)],
+                            vertices_[triangles_[k](2)], tk) &&
+                tk >= 0 && tk <= max_t) {
+                max_t = tk;
+                t = tk;
+                triangle = triangle_indices_[k];
+                hit = true;
+            }
+        }
+    }
+    return hit;
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::GetSelfIntersectingTriangles()
+        const {
+    std::vector<Eigen::Vector2i> self_intersecting_triangles;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<Eigen::Vector2i> pairs;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256) nowait
+#endif
+        for (int k = 0; k < int(triangles_.size()); k++) {
+            const Eigen::Vector3i &tria_p = triangles_[k];
+            const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+            const int tidx0 = triangle_indices_[k];
+            ForEachLeafTriangleInBox(
+                    p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                    [&](int l) {
+                        const int tidx1 = triangle_indices_[l];
+                        const Eigen::Vector3i &tria_q = triangles_[l];
+                        if (tidx1 > tidx0 && !ShareVertex(tria_p, tria_q) &&
+                            IntersectionTest::TriangleTriangle3d(
+                                    p0, p1, p2, vertices_[tria_q(0)],
+                                    vertices_[tria_q(1)],
+                                    vertices_[tria_q(2)])) {
+                            pairs.push_back(Eigen::Vector2i(tidx0, tidx1));
+                        }
+                        return true;
+                    });
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        self_intersecting_triangles.insert(self_intersecting_triangles.end(),
+                                           pairs.begin(), pairs.end());
+    }
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
+    return self_intersecting_triangles;
+}
+
+bool TriangleMeshBVH::IsIntersecting(const TriangleMesh &mesh) const {
+    std::atomic<bool> intersecting(false);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int tidx = 0; tidx < int(mesh.triangles_.size()); tidx++) {
+        if (intersecting.load(std::memory_order_relaxed)) continue;
+        const Eigen::Vector3i &tria_p = mesh.triangles_[tidx];
+        const Eigen::Vector3d &p0 = mesh.vertices_[tria_p(0)];
+        const Eigen::Vector3d &p1 = mesh.vertices_[tria_p(1)];
+        const Eigen::Vector3d &p2 = mesh.vertices_[tria_p(2)];
+        const bool found = !ForEachLeafTriangleInBox(
+                p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                [&](int l) {
+                    const Eigen::Vector3i &tria_q = triangles_[l];
+                    return !IntersectionTest::TriangleTriangle3d(
+                            p0, p1, p2, vertices_[tria_q(0)],
+                            vertices_[tria_q(1)], vertices_[tria_q(2)]);
+                });
+        if (found) intersecting.store(true, std::memory_order_relaxed);
+    }
+    return intersecting.load();
+}
+
+}  // namespace geometry
+}  // namespace open3d
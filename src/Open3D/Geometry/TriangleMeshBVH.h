@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <limits>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a TriangleMesh, for
+/// queries on the triangles near a box, a point or a ray.
+///
+/// The hierarchy is built in parallel with the surface area heuristic and
+/// stored as an array of nodes in depth-first order. The bounds of the nodes
+/// are stored in single precision, rounded outwards.
+class TriangleMeshBVH {
+public:
+    /// \brief A node of the hierarchy. The first child of an inner node
+    /// follows it in the array of nodes.
+    struct Node {
+        Eigen::Vector3f min_bound_;
+        Eigen::Vector3f max_bound_;
+        /// Leaves: position of the first triangle of the leaf in the leaf
+        /// order. Inner nodes: index of the second child.
+        int offset_;
+        /// Number of triangles of a leaf, 0 for an inner node.
+        int num_triangles_;
+
+        bool IsLeaf() const { return num_triangles_ > 0; }
+
+        bool Overlaps(const Eigen::Vector3d &min_bound,
+                      const Eigen::Vector3d &max_bound) const {
+            return min_bound_(0) <= max_bound(0) &&
+                   min_bound(0) <= max_bound_(0) &&
+                   min_bound_(1) <= max_bound(1) &&
+                   min_bound(1) <= max_bound_(1) &&
+                   min_bound_(2) <= max_bound(2) &&
+                   min_bound(2) <= max_bound_(2);
+        }
+    };
+
+    /// Maximum depth of the hierarchy.
+    static const int kMaxDepth = 128;
+
+    /// \brief Default Constructor.
+    TriangleMeshBVH() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Provides the triangles from which the hierarchy is built.
+    explicit TriangleMeshBVH(const TriangleMesh &mesh);
+
+public:
+    /// Builds the hierarchy over the triangles of \p mesh, whose vertices and
+    /// triangles are copied.
+    bool SetGeometry(const TriangleMesh &mesh);
+
+    /// Calls \p func with the index of every triangle whose bounding box
+    /// overlaps the box from \p min_bound to \p max_bound, until it returns
+    /// false.
+    ///
+    /// \return false if \p func stopped the query.
+    template <typename Func>
+    bool ForEachTriangleInBox(const Eigen::Vector3d &min_bound,
+                              const Eigen::Vector3d &max_bound,
+                              Func func) const {
+        return ForEachLeafTriangleInBox(min_bound, max_bound, [&](int k) {
+            return func(triangle_indices_[k]);
+        });
+    }
+
+    /// Finds the point of the mesh closest to \p query.
+    ///
+    /// \return The distance to the closest point, -1 if the mesh has no
+    /// triangles.
+    double ClosestPoint(const Eigen::Vector3d &query,
+                        Eigen::Vector3d &closest_point,
+                        int &triangle) const;
+
+    /// Finds the first triangle hit by the ray origin + t * direction, with
+    /// t in [0, \p max_t].
+    ///
+    /// \return true if a triangle is hit, and then sets \p t and
+    /// \p triangle.
+    bool RayCast(const Eigen::Vector3d &origin,
+                 const Eigen::Vector3d &direction,
+                 double &t,
+                 int &triangle,
+                 double max_t = std::numeric_limits<double>::infinity()) const;
+
+    /// Returns the pairs of intersecting triangles that share no vertex,
+    /// each one ordered and the pairs sorted.
+    std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
+
+    /// Tests if a triangle of \p mesh intersects a triangle of the hierarchy.
+    bool IsIntersecting(const TriangleMesh &mesh) const;
+
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+
+    /// The index of the triangle at every position of the leaf order.
+    const std::vector<int> &GetTriangleIndices() const {
+        return triangle_indices_;
+    }
+
+protected:
+    /// Calls \p func with the position in the leaf order of every triangle
+    /// whose bounding box overlaps the box, until it returns false.
+    template <typename Func>
+    bool ForEachLeafTriangleInBox(const Eigen::Vector3d &min_bound,
+                                  const Eigen::Vector3d &max_bound,
+                                  Func func) const {
+        if (nodes_.empty()) return true;
+        int stack[kMaxDepth + 1];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const int n = stack[--top];
+            const Node &node = nodes_[n];
+            if (!node.Overlaps(min_bound, max_bound)) continue;
+            if (!node.IsLeaf()) {
+                stack[top++] = node.offset_;
+                stack[top++] = n + 1;
+                continue;
+            }
+            for (int k = node.offset_;
+                 k < node.offset_ + node.num_triangles_; k++) {
+                if (TriangleOverlaps(k, min_bound, max_bound) && !func(k)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool TriangleOverlaps(int k,
+                          const Eigen::Vector3d &min_bound,
+                          const Eigen::Vector3d &max_bound) const {
+        const Eigen::Vector3d &v0 = vertices_[triangles_[k](0)];
+        const Eigen::Vector3d &v1 = vertices_[triangles_[k](1)];
+        const Eigen::Vector3d &v2 = vertices_[triangles_[k](2)];
+        return (v0.cwiseMin(v1).cwiseMin(v2).array() <= max_bound.array())
+                       .all() &&
+               (v0.cwiseMax(v1).cwiseMax(v2).array() >= min_bound.array())
+                       .all();
+    }
+
+protected:
+    std::vector<Node> nodes_;
+    std::vector<Eigen::Vector3d> vertices_;
+    /// The triangles in the leaf order.
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<int> triangle_indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 
@@ -68,5 +69,25 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+/// Reads a PinholeCameraTrajectory written by WritePinholeCameraTrajectoryToBIN
+/// or AppendPinholeCameraParametersToBIN. Fails if the header does not match
+/// or the file holds fewer records than its header counts.
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+/// Writes the intrinsics and extrinsics of a PinholeCameraTrajectory as a
+/// versioned header followed by fixed size little-endian records.
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
+/// Appends camera parameters to a trajectory BIN file without rewriting it,
+/// creating the file if it does not exist. Intended for streaming long
+/// trajectories to disk one frame at a time.
+bool AppendPinholeCameraParametersToBIN(
+        const std::string &filename,
+        const std::vector<camera::PinholeCameraParameters> &parameters);
+
 }  // namespace io
 }  // namespace open3d
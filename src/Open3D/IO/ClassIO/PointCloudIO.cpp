@@ -63,6 +63,27 @@ static const std::unordered_map<std::string,
                 {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
         };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(
+                const std::string &, geometry::PointCloudFloat &, bool)>>
+        file_extension_to_pointcloud_float_read_function{
+                {"ply", ReadPointCloudFloatFromPLY},
+                {"pcd", ReadPointCloudFloatFromPCD},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &,
+                           const geometry::PointCloudFloat &,
+                           const bool,
+                           const bool,
+                           const bool)>>
+        file_extension_to_pointcloud_float_write_function{
+                {"ply", WritePointCloudFloatToPLY},
+                {"pcd", WritePointCloudFloatToPCD},
+        };
 }  // unnamed namespace
 
 namespace io {
@@ -141,5 +162,58 @@ bool WritePointCloud(const std::string &filename,
     return success;
 }
 
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloudFloat &pointcloud,
+                    const std::string &format,
+                    bool remove_nan_points,
+                    bool remove_infinite_points,
+                    bool print_progress) {
+    std::string filename_ext;
+    if (format == "auto") {
+        filename_ext =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    } else {
+        filename_ext = format;
+    }
+    auto map_itr =
+            file_extension_to_pointcloud_float_read_function.find(filename_ext);
+    if (map_itr == file_extension_to_pointcloud_float_read_function.end()) {
+        utility::LogWarning(
+                "Read geometry::PointCloudFloat failed: unsupported file "
+                "extension.");
+        return false;
+    }
+    bool success = map_itr->second(filename, pointcloud, print_progress);
+    utility::LogDebug("Read geometry::PointCloudFloat: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    if (remove_nan_points || remove_infinite_points) {
+        pointcloud.RemoveNonFinitePoints(remove_nan_points,
+                                         remove_infinite_points);
+    }
+    return success;
+}
+
+bool WritePointCloud(const std::string &filename,
+                     const geometry::PointCloudFloat &pointcloud,
+                     bool write_ascii /* = false*/,
+                     bool compressed /* = false*/,
+                     bool print_progress) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr = file_extension_to_pointcloud_float_write_function.find(
+            filename_ext);
+    if (map_itr == file_extension_to_pointcloud_float_write_function.end()) {
+        utility::LogWarning(
+                "Write geometry::PointCloudFloat failed: unsupported file "
+                "extension.");
+        return false;
+    }
+    bool success = map_itr->second(filename, pointcloud, write_ascii,
+                                   compressed, print_progress);
+    utility::LogDebug("Write geometry::PointCloudFloat: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -29,6 +29,7 @@
 #include <string>
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudFloat.h"
 
 namespace open3d {
 namespace io {
@@ -61,6 +62,26 @@ bool WritePointCloud(const std::string &filename,
                      bool compressed = false,
                      bool print_progress = false);
 
+/// The general entrance for reading a PointCloudFloat from a file.
+/// Only the ply and pcd formats are supported, the values are read directly
+/// into single precision.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloudFloat &pointcloud,
+                    const std::string &format = "auto",
+                    bool remove_nan_points = true,
+                    bool remove_infinite_points = true,
+                    bool print_progress = false);
+
+/// The general entrance for writing a PointCloudFloat to a file.
+/// Only the ply and pcd formats are supported.
+/// \return return true if the write function is successful, false otherwise.
+bool WritePointCloud(const std::string &filename,
+                     const geometry::PointCloudFloat &pointcloud,
+                     bool write_ascii = false,
+                     bool compressed = false,
+                     bool print_progress = false);
+
 bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress = false);
@@ -111,6 +132,26 @@ bool WritePointCloudToPCD(const std::string &filename,
                           bool compressed = false,
                           bool print_progress = false);
 
+bool ReadPointCloudFloatFromPLY(const std::string &filename,
+                                geometry::PointCloudFloat &pointcloud,
+                                bool print_progress = false);
+
+bool WritePointCloudFloatToPLY(const std::string &filename,
+                               const geometry::PointCloudFloat &pointcloud,
+                               bool write_ascii = false,
+                               bool compressed = false,
+                               bool print_progress = false);
+
+bool ReadPointCloudFloatFromPCD(const std::string &filename,
+                                geometry::PointCloudFloat &pointcloud,
+                                bool print_progress = false);
+
+bool WritePointCloudFloatToPCD(const std::string &filename,
+                               const geometry::PointCloudFloat &pointcloud,
+                               bool write_ascii = false,
+                               bool compressed = false,
+                               bool print_progress = false);
+
 bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress = false);
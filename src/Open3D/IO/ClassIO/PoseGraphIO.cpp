@@ -52,6 +52,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
                 {"json", ReadPoseGraphFromJSON},
+                {"bin", ReadPoseGraphFromBIN},
         };
 
 static const std::unordered_map<
@@ -60,6 +61,7 @@ static const std::unordered_map<
                            const registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
                 {"json", WritePoseGraphToJSON},
+                {"bin", WritePoseGraphToBIN},
         };
 
 }  // unnamed namespace
@@ -51,5 +51,14 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const registration::PoseGraph &pose_graph);
 
+/// Reads a PoseGraph from the binary format written by WritePoseGraphToBIN().
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph);
+
+/// Writes a PoseGraph as a versioned header followed by raw little-endian
+/// arrays of the node poses and edge data. Much faster to read than JSON.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
@@ -24,10 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 
@@ -72,6 +78,239 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+// The pose graph and trajectory BIN files start with a 8 byte magic string
+// and a version number, followed by little-endian counts and raw arrays:
+//
+// PoseGraph:  magic "O3DPOSEG", uint32 version, uint32 reserved,
+//             uint64 num_nodes, uint64 num_edges,
+//             double[num_nodes][16] node poses,
+//             int32[num_edges][2] source and target node ids,
+//             double[num_edges][16] edge transformations,
+//             double[num_edges][36] edge information matrices,
+//             double[num_edges] confidences, uint8[num_edges] uncertain flags.
+// Trajectory: magic "O3DTRAJC", uint32 version, uint32 reserved,
+//             uint64 num_parameters, followed by num_parameters records of
+//             int32 width, int32 height, double[9] intrinsic matrix and
+//             double[16] extrinsic matrix.
+//
+// All matrices are stored column major. A trajectory can be extended in place
+// by AppendPinholeCameraParametersToBIN(); num_parameters is only rewritten
+// once the new records are on disk, so an interrupted append leaves a valid
+// file.
+const char kPoseGraphBINMagic[8] = {'O', '3', 'D', 'P', 'O', 'S', 'E', 'G'};
+const char kTrajectoryBINMagic[8] = {'O', '3', 'D', 'T', 'R', 'A', 'J', 'C'};
+const uint32_t kBINVersion = 1;
+
+struct BINHeader {
+    char magic_[8];
+    uint32_t version_;
+    uint32_t reserved_;
+};
+
+struct TrajectoryBINRecord {
+    int32_t width_;
+    int32_t height_;
+    double intrinsic_[9];
+    double extrinsic_[16];
+};
+static_assert(sizeof(TrajectoryBINRecord) == 208,
+              "TrajectoryBINRecord must not be padded.");
+
+// Arrays are read in chunks so that a corrupted count fails at the end of the
+// file instead of allocating the whole count up front.
+const uint64_t kBINReadChunkSize = 1 << 16;
+
+bool IsLittleEndian() {
+    const uint32_t one = 1;
+    unsigned char first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+template <typename T>
+bool ReadArrayFromBINFile(FILE *file, uint64_t count, std::vector<T> &data) {
+    data.clear();
+    while (data.size() < count) {
+        size_t offset = data.size();
+        size_t chunk = (size_t)std::min(count - offset, kBINReadChunkSize);
+        data.resize(offset + chunk);
+        if (fread(data.data() + offset, sizeof(T), chunk, file) < chunk) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool WriteArrayToBINFile(FILE *file, const std::vector<T> &data) {
+    if (fwrite(data.data(), sizeof(T), data.size(), file) < data.size()) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadHeaderFromBINFile(FILE *file, const char *magic) {
+    if (!IsLittleEndian()) {
+        utility::LogWarning(
+                "Read BIN failed: only little-endian hosts are supported.");
+        return false;
+    }
+    BINHeader header;
+    if (fread(&header, sizeof(BINHeader), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (std::memcmp(header.magic_, magic, sizeof(header.magic_)) != 0) {
+        utility::LogWarning("Read BIN failed: unrecognized format.");
+        return false;
+    }
+    if (header.version_ > kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported version {:d}.",
+                            header.version_);
+        return false;
+    }
+    return true;
+}
+
+bool WriteHeaderToBINFile(FILE *file, const char *magic) {
+    if (!IsLittleEndian()) {
+        utility::LogWarning(
+                "Write BIN failed: only little-endian hosts are supported.");
+        return false;
+    }
+    BINHeader header;
+    std::memcpy(header.magic_, magic, sizeof(header.magic_));
+    header.version_ = kBINVersion;
+    header.reserved_ = 0;
+    if (fwrite(&header, sizeof(BINHeader), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadPoseGraphFromBINFile(FILE *file, registration::PoseGraph &pose_graph) {
+    uint64_t counts[2];
+    if (!ReadHeaderFromBINFile(file, kPoseGraphBINMagic)) return false;
+    if (fread(counts, sizeof(uint64_t), 2, file) < 2) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    uint64_t num_nodes = counts[0], num_edges = counts[1];
+    std::vector<double> poses, transformations, information, confidences;
+    std::vector<int32_t> node_ids;
+    std::vector<uint8_t> uncertain;
+    if (!ReadArrayFromBINFile(file, num_nodes * 16, poses) ||
+        !ReadArrayFromBINFile(file, num_edges * 2, node_ids) ||
+        !ReadArrayFromBINFile(file, num_edges * 16, transformations) ||
+        !ReadArrayFromBINFile(file, num_edges * 36, information) ||
+        !ReadArrayFromBINFile(file, num_edges, confidences) ||
+        !ReadArrayFromBINFile(file, num_edges, uncertain)) {
+        return false;
+    }
+    pose_graph.nodes_.resize((size_t)num_nodes);
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        pose_graph.nodes_[i].pose_ =
+                Eigen::Map<const Eigen::Matrix4d>(poses.data() + i * 16);
+    }
+    pose_graph.edges_.resize((size_t)num_edges);
+    for (size_t i = 0; i < pose_graph.edges_.size(); i++) {
+        registration::PoseGraphEdge &edge = pose_graph.edges_[i];
+        edge.source_node_id_ = node_ids[i * 2];
+        edge.target_node_id_ = node_ids[i * 2 + 1];
+        edge.transformation_ = Eigen::Map<const Eigen::Matrix4d>(
+                transformations.data() + i * 16);
+        edge.information_ = Eigen::Map<const Eigen::Matrix6d>(
+                information.data() + i * 36);
+        edge.confidence_ = confidences[i];
+        edge.uncertain_ = uncertain[i] != 0;
+    }
+    return true;
+}
+
+bool WritePoseGraphToBINFile(FILE *file,
+                             const registration::PoseGraph &pose_graph) {
+    size_t num_nodes = pose_graph.nodes_.size();
+    size_t num_edges = pose_graph.edges_.size();
+    std::vector<double> poses(num_nodes * 16);
+    for (size_t i = 0; i < num_nodes; i++) {
+        Eigen::Map<Eigen::Matrix4d>(poses.data() + i * 16) =
+                pose_graph.nodes_[i].pose_;
+    }
+    std::vector<int32_t> node_ids(num_edges * 2);
+    std::vector<double> transformations(num_edges * 16);
+    std::vector<double> information(num_edges * 36);
+    std::vector<double> confidences(num_edges);
+    std::vector<uint8_t> uncertain(num_edges);
+    for (size_t i = 0; i < num_edges; i++) {
+        const registration::PoseGraphEdge &edge = pose_graph.edges_[i];
+        node_ids[i * 2] = edge.source_node_id_;
+        node_ids[i * 2 + 1] = edge.target_node_id_;
+        Eigen::Map<Eigen::Matrix4d>(transformations.data() + i * 16) =
+                edge.transformation_;
+        Eigen::Map<Eigen::Matrix6d>(information.data() + i * 36) =
+                edge.information_;
+        confidences[i] = edge.confidence_;
+        uncertain[i] = edge.uncertain_ ? 1 : 0;
+    }
+    uint64_t counts[2] = {num_nodes, num_edges};
+    if (!WriteHeaderToBINFile(file, kPoseGraphBINMagic)) return false;
+    if (fwrite(counts, sizeof(uint64_t), 2, file) < 2) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return WriteArrayToBINFile(file, poses) &&
+           WriteArrayToBINFile(file, node_ids) &&
+           WriteArrayToBINFile(file, transformations) &&
+           WriteArrayToBINFile(file, information) &&
+           WriteArrayToBINFile(file, confidences) &&
+           WriteArrayToBINFile(file, uncertain);
+}
+
+std::vector<TrajectoryBINRecord> ConvertTrajectoryToBINRecords(
+        const std::vector<camera::PinholeCameraParameters> &parameters) {
+    std::vector<TrajectoryBINRecord> records(parameters.size());
+    for (size_t i = 0; i < parameters.size(); i++) {
+        records[i].width_ = parameters[i].intrinsic_.width_;
+        records[i].height_ = parameters[i].intrinsic_.height_;
+        Eigen::Map<Eigen::Matrix3d>(records[i].intrinsic_) =
+                parameters[i].intrinsic_.intrinsic_matrix_;
+        Eigen::Map<Eigen::Matrix4d>(records[i].extrinsic_) =
+                parameters[i].extrinsic_;
+    }
+    return records;
+}
+
+bool ReadTrajectoryCountFromBINFile(FILE *file, uint64_t &count) {
+    if (!ReadHeaderFromBINFile(file, kTrajectoryBINMagic)) return false;
+    if (fread(&count, sizeof(uint64_t), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+/// fseek from the start of \p file to a 64-bit \p offset, long being 32-bit
+/// on Windows.
+int SeekBINFile(FILE *file, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, SEEK_SET);
+#else
+    return fseeko(file, off_t(offset), SEEK_SET);
+#endif
+}
+
+bool WriteTrajectoryCountToBINFile(FILE *file, uint64_t count) {
+    if (fseek(file, sizeof(BINHeader), SEEK_SET) != 0 ||
+        fwrite(&count, sizeof(uint64_t), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +341,112 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = ReadPoseGraphFromBINFile(fid, pose_graph);
+    fclose(fid);
+    return success;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WritePoseGraphToBINFile(fid, pose_graph);
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    uint64_t count;
+    std::vector<TrajectoryBINRecord> records;
+    bool success = ReadTrajectoryCountFromBINFile(fid, count) &&
+                   ReadArrayFromBINFile(fid, count, records);
+    fclose(fid);
+    if (!success) return false;
+    trajectory.parameters_.resize(records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        camera::PinholeCameraParameters &parameters =
+                trajectory.parameters_[i];
+        parameters.intrinsic_.width_ = records[i].width_;
+        parameters.intrinsic_.height_ = records[i].height_;
+        parameters.intrinsic_.intrinsic_matrix_ =
+                Eigen::Map<const Eigen::Matrix3d>(records[i].intrinsic_);
+        parameters.extrinsic_ =
+                Eigen::Map<const Eigen::Matrix4d>(records[i].extrinsic_);
+    }
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    uint64_t count = trajectory.parameters_.size();
+    bool success =
+            WriteHeaderToBINFile(fid, kTrajectoryBINMagic) &&
+            WriteTrajectoryCountToBINFile(fid, count) &&
+            WriteArrayToBINFile(
+                    fid, ConvertTrajectoryToBINRecords(trajectory.parameters_));
+    fclose(fid);
+    return success;
+}
+
+bool AppendPinholeCameraParametersToBIN(
+        const std::string &filename,
+        const std::vector<camera::PinholeCameraParameters> &parameters) {
+    FILE *fid = utility::filesystem::FOpen(filename, "r+b");
+    if (fid == NULL) {
+        // Start a new trajectory.
+        camera::PinholeCameraTrajectory trajectory;
+        trajectory.parameters_ = parameters;
+        return WritePinholeCameraTrajectoryToBIN(filename, trajectory);
+    }
+    uint64_t count;
+    if (!ReadTrajectoryCountFromBINFile(fid, count)) {
+        fclose(fid);
+        return false;
+    }
+    // Records past count are left over from an interrupted append and are
+    // overwritten.
+    int64_t offset = int64_t(sizeof(BINHeader) + sizeof(uint64_t) +
+                             count * sizeof(TrajectoryBINRecord));
+    bool success =
+            SeekBINFile(fid, offset) == 0 &&
+            WriteArrayToBINFile(fid,
+                                ConvertTrajectoryToBINRecords(parameters)) &&
+            fflush(fid) == 0 &&
+            WriteTrajectoryCountToBINFile(fid, count + parameters.size());
+    if (fclose(fid) != 0) success = false;
+    if (!success) {
+        utility::LogWarning("Append BIN failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
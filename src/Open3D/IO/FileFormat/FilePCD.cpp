@@ -332,9 +332,9 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
-bool ReadPCDData(FILE *file,
-                 const PCDHeader &header,
-                 geometry::PointCloud &pointcloud) {
+template <typename CloudType>
+bool ReadPCDData(FILE *file, const PCDHeader &header, CloudType &pointcloud) {
+    typedef typename decltype(CloudType::colors_)::value_type::Scalar scalar_t;
     // The header should have been checked
     if (header.has_points) {
         pointcloud.points_.resize(header.points);
@@ -387,9 +387,11 @@ bool ReadPCDData(FILE *file,
                             strs[field.count_offset].c_str(), field.type,
                             field.size);
                 } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[idx] = UnpackASCIIPCDColor(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
+                    pointcloud.colors_[idx] =
+                            UnpackASCIIPCDColor(
+                                    strs[field.count_offset].c_str(),
+                                    field.type, field.size)
+                                    .template cast<scalar_t>();
                 }
             }
             idx++;
@@ -431,7 +433,8 @@ bool ReadPCDData(FILE *file,
                 } else if (field.name == "rgb" || field.name == "rgba") {
                     pointcloud.colors_[i] =
                             UnpackBinaryPCDColor(buffer.get() + field.offset,
-                                                 field.type, field.size);
+                                                 field.type, field.size)
+                                    .template cast<scalar_t>();
                 }
             }
         }
@@ -509,9 +512,11 @@ bool ReadPCDData(FILE *file,
                 }
             } else if (field.name == "rgb" || field.name == "rgba") {
                 for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
+                    pointcloud.colors_[i] =
+                            UnpackBinaryPCDColor(
+                                    base_ptr + i * field.size * field.count,
+                                    field.type, field.size)
+                                    .template cast<scalar_t>();
                 }
             }
         }
@@ -519,7 +524,8 @@ bool ReadPCDData(FILE *file,
     return true;
 }
 
-bool GenerateHeader(const geometry::PointCloud &pointcloud,
+template <typename CloudType>
+bool GenerateHeader(const CloudType &pointcloud,
                     const bool write_ascii,
                     const bool compressed,
                     PCDHeader &header) {
@@ -625,9 +631,10 @@ float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     return value;
 }
 
+template <typename CloudType>
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
-                  const geometry::PointCloud &pointcloud) {
+                  const CloudType &pointcloud) {
     bool has_normal = pointcloud.HasNormals();
     bool has_color = pointcloud.HasColors();
     if (header.datatype == PCD_DATA_ASCII) {
@@ -640,7 +647,8 @@ bool WritePCDData(FILE *file,
                         normal(2));
             }
             if (has_color) {
-                const auto &color = pointcloud.colors_[i];
+                const Eigen::Vector3d color =
+                        pointcloud.colors_[i].template cast<double>();
                 fprintf(file, " %.10g", ConvertRGBToFloat(color));
             }
             fprintf(file, "\n");
@@ -661,7 +669,8 @@ bool WritePCDData(FILE *file,
                 idx += 3;
             }
             if (has_color) {
-                const auto &color = pointcloud.colors_[i];
+                const Eigen::Vector3d color =
+                        pointcloud.colors_[i].template cast<double>();
                 data[idx] = ConvertRGBToFloat(color);
             }
             fwrite(data.get(), sizeof(float), header.elementnum, file);
@@ -686,7 +695,8 @@ bool WritePCDData(FILE *file,
                 idx += 3;
             }
             if (has_color) {
-                const auto &color = pointcloud.colors_[i];
+                const Eigen::Vector3d color =
+                        pointcloud.colors_[i].template cast<double>();
                 buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
             }
         }
@@ -708,12 +718,9 @@ bool WritePCDData(FILE *file,
     return true;
 }
 
-}  // unnamed namespace
-
-namespace io {
-bool ReadPointCloudFromPCD(const std::string &filename,
-                           geometry::PointCloud &pointcloud,
-                           bool print_progress) {
+template <typename CloudType>
+bool ReadPointCloudFromPCDImpl(const std::string &filename,
+                               CloudType &pointcloud) {
     PCDHeader header;
     FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
     if (file == NULL) {
@@ -748,11 +755,11 @@ bool ReadPointCloudFromPCD(const std::string &filename,
     return true;
 }
 
-bool WritePointCloudToPCD(const std::string &filename,
-                          const geometry::PointCloud &pointcloud,
-                          bool write_ascii /* = false*/,
-                          bool compressed /* = false*/,
-                          bool print_progress) {
+template <typename CloudType>
+bool WritePointCloudToPCDImpl(const std::string &filename,
+                              const CloudType &pointcloud,
+                              bool write_ascii,
+                              bool compressed) {
     PCDHeader header;
     if (GenerateHeader(pointcloud, write_ascii, compressed, header) == false) {
         utility::LogWarning("Write PCD failed: unable to generate header.");
@@ -777,5 +784,38 @@ bool WritePointCloudToPCD(const std::string &filename,
     return true;
 }
 
+}  // unnamed namespace
+
+namespace io {
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress) {
+    return ReadPointCloudFromPCDImpl(filename, pointcloud);
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToPCDImpl(filename, pointcloud, write_ascii,
+                                    compressed);
+}
+
+bool ReadPointCloudFloatFromPCD(const std::string &filename,
+                                geometry::PointCloudFloat &pointcloud,
+                                bool print_progress) {
+    return ReadPointCloudFromPCDImpl(filename, pointcloud);
+}
+
+bool WritePointCloudFloatToPCD(const std::string &filename,
+                               const geometry::PointCloudFloat &pointcloud,
+                               bool write_ascii /* = false*/,
+                               bool compressed /* = false*/,
+                               bool print_progress) {
+    return WritePointCloudToPCDImpl(filename, pointcloud, write_ascii,
+                                    compressed);
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -39,9 +39,10 @@ using namespace io;
 
 namespace ply_pointcloud_reader {
 
+template <typename CloudType>
 struct PLYReaderState {
     utility::ConsoleProgressBar *progress_bar;
-    geometry::PointCloud *pointcloud_ptr;
+    CloudType *pointcloud_ptr;
     long vertex_index;
     long vertex_num;
     long normal_index;
@@ -50,8 +51,9 @@ struct PLYReaderState {
     long color_num;
 };
 
+template <typename CloudType>
 int ReadVertexCallback(p_ply_argument argument) {
-    PLYReaderState *state_ptr;
+    PLYReaderState<CloudType> *state_ptr;
     long index;
     ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
                                &index);
@@ -68,8 +70,9 @@ int ReadVertexCallback(p_ply_argument argument) {
     return 1;
 }
 
+template <typename CloudType>
 int ReadNormalCallback(p_ply_argument argument) {
-    PLYReaderState *state_ptr;
+    PLYReaderState<CloudType> *state_ptr;
     long index;
     ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
                                &index);
@@ -85,8 +88,9 @@ int ReadNormalCallback(p_ply_argument argument) {
     return 1;
 }
 
+template <typename CloudType>
 int ReadColorCallback(p_ply_argument argument) {
-    PLYReaderState *state_ptr;
+    PLYReaderState<CloudType> *state_ptr;
     long index;
     ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
                                &index);
@@ -351,13 +355,10 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
-}  // unnamed namespace
-
-namespace io {
-
-bool ReadPointCloudFromPLY(const std::string &filename,
-                           geometry::PointCloud &pointcloud,
-                           bool print_progress) {
+template <typename CloudType>
+bool ReadPointCloudFromPLYImpl(const std::string &filename,
+                               CloudType &pointcloud,
+                               bool print_progress) {
     using namespace ply_pointcloud_reader;
 
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
@@ -372,22 +373,30 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         return false;
     }
 
-    PLYReaderState state;
+    PLYReaderState<CloudType> state;
     state.pointcloud_ptr = &pointcloud;
     state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
-                                       ReadVertexCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+                                       ReadVertexCallback<CloudType>, &state,
+                                       0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback<CloudType>,
+                    &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback<CloudType>,
+                    &state, 2);
 
     state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
-                                       ReadNormalCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
+                                       ReadNormalCallback<CloudType>, &state,
+                                       0);
+    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback<CloudType>,
+                    &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback<CloudType>,
+                    &state, 2);
 
     state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
-                                      ReadColorCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
+                                      ReadColorCallback<CloudType>, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback<CloudType>,
+                    &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback<CloudType>,
+                    &state, 2);
 
     if (state.vertex_num <= 0) {
         utility::LogWarning("Read PLY failed: number of vertex <= 0.");
@@ -420,11 +429,15 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     return true;
 }
 
-bool WritePointCloudToPLY(const std::string &filename,
-                          const geometry::PointCloud &pointcloud,
-                          bool write_ascii /* = false*/,
-                          bool compressed /* = false*/,
-                          bool print_progress) {
+template <typename CloudType>
+bool WritePointCloudToPLYImpl(const std::string &filename,
+                              const CloudType &pointcloud,
+                              bool write_ascii,
+                              bool print_progress) {
+    typedef typename decltype(CloudType::points_)::value_type::Scalar scalar_t;
+    // Points and normals are stored with the precision of the point cloud.
+    const e_ply_type ply_type =
+            std::is_same<scalar_t, float>::value ? PLY_FLOAT : PLY_DOUBLE;
     if (pointcloud.IsEmpty()) {
         utility::LogWarning("Write PLY failed: point cloud has 0 points.");
         return false;
@@ -441,13 +454,13 @@ bool WritePointCloudToPLY(const std::string &filename,
     ply_add_comment(ply_file, "Created by Open3D");
     ply_add_element(ply_file, "vertex",
                     static_cast<long>(pointcloud.points_.size()));
-    ply_add_property(ply_file, "x", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "y", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "z", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    ply_add_property(ply_file, "x", ply_type, ply_type, ply_type);
+    ply_add_property(ply_file, "y", ply_type, ply_type, ply_type);
+    ply_add_property(ply_file, "z", ply_type, ply_type, ply_type);
     if (pointcloud.HasNormals()) {
-        ply_add_property(ply_file, "nx", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "ny", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "nz", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+        ply_add_property(ply_file, "nx", ply_type, ply_type, ply_type);
+        ply_add_property(ply_file, "ny", ply_type, ply_type, ply_type);
+        ply_add_property(ply_file, "nz", ply_type, ply_type, ply_type);
     }
     if (pointcloud.HasColors()) {
         ply_add_property(ply_file, "red", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
@@ -466,18 +479,19 @@ bool WritePointCloudToPLY(const std::string &filename,
 
     bool printed_color_warning = false;
     for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const Eigen::Vector3d &point = pointcloud.points_[i];
+        const auto &point = pointcloud.points_[i];
         ply_write(ply_file, point(0));
         ply_write(ply_file, point(1));
         ply_write(ply_file, point(2));
         if (pointcloud.HasNormals()) {
-            const Eigen::Vector3d &normal = pointcloud.normals_[i];
+            const auto &normal = pointcloud.normals_[i];
             ply_write(ply_file, normal(0));
             ply_write(ply_file, normal(1));
             ply_write(ply_file, normal(2));
         }
         if (pointcloud.HasColors()) {
-            const Eigen::Vector3d &color = pointcloud.colors_[i];
+            const Eigen::Vector3d color =
+                    pointcloud.colors_[i].template cast<double>();
             if (!printed_color_warning &&
                 (color(0) < 0 || color(0) > 1 || color(1) < 0 || color(1) > 1 ||
                  color(2) < 0 || color(2) > 1)) {
@@ -499,6 +513,40 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPointCloudFromPLY(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress) {
+    return ReadPointCloudFromPLYImpl(filename, pointcloud, print_progress);
+}
+
+bool WritePointCloudToPLY(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToPLYImpl(filename, pointcloud, write_ascii,
+                                    print_progress);
+}
+
+bool ReadPointCloudFloatFromPLY(const std::string &filename,
+                                geometry::PointCloudFloat &pointcloud,
+                                bool print_progress) {
+    return ReadPointCloudFromPLYImpl(filename, pointcloud, print_progress);
+}
+
+bool WritePointCloudFloatToPLY(const std::string &filename,
+                               const geometry::PointCloudFloat &pointcloud,
+                               bool write_ascii /* = false*/,
+                               bool compressed /* = false*/,
+                               bool print_progress) {
+    return WritePointCloudToPLYImpl(filename, pointcloud, write_ascii,
+                                    print_progress);
+}
+
 bool ReadTriangleMeshFromPLY(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
@@ -154,54 +154,47 @@ Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
 
     const auto &target_c = (const PointCloudForColoredICP &)target;
 
-    auto compute_jacobian_and_residual =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                size_t cs = corres[i][0];
-                size_t ct = corres[i][1];
-                const Eigen::Vector3d &vs = source.points_[cs];
-                const Eigen::Vector3d &vt = target.points_[ct];
-                const Eigen::Vector3d &nt = target.normals_[ct];
-
-                J_r.resize(2);
-                r.resize(2);
-
-                J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
-                J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
-                r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
-
-                // project vs into vt's tangential plane
-                Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-                double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                             source.colors_[cs](2)) /
-                            3.0;
-                double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                             target.colors_[ct](2)) /
-                            3.0;
-                const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-                double is0_proj = (dit.dot(vs_proj - vt)) + it;
-
-                const Eigen::Matrix3d M =
-                        (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0),
-                         -nt(0) * nt(1), -nt(0) * nt(2), -nt(0) * nt(1),
-                         1.0 - nt(1) * nt(1), -nt(1) * nt(2), -nt(0) * nt(2),
-                         -nt(1) * nt(2), 1.0 - nt(2) * nt(2))
-                                .finished();
-
-                const Eigen::Vector3d &ditM = -dit.transpose() * M;
-                J_r[1].block<3, 1>(0, 0) =
-                        sqrt_lambda_photometric * vs.cross(ditM);
-                J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
-                r[1] = sqrt_lambda_photometric * (is - is0_proj);
-            };
+    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d *J_r,
+                                             double *r) {
+        size_t cs = corres[i][0];
+        size_t ct = corres[i][1];
+        const Eigen::Vector3d &vs = source.points_[cs];
+        const Eigen::Vector3d &vt = target.points_[ct];
+        const Eigen::Vector3d &nt = target.normals_[ct];
+
+        J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
+        J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
+        r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
+
+        // project vs into vt's tangential plane
+        Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
+        double is = (source.colors_[cs](0) + source.colors_[cs](1) +
+                     source.colors_[cs](2)) /
+                    3.0;
+        double it = (target.colors_[ct](0) + target.colors_[ct](1) +
+                     target.colors_[ct](2)) /
+                    3.0;
+        const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
+        double is0_proj = (dit.dot(vs_proj - vt)) + it;
+
+        const Eigen::Matrix3d M =
+                (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0), -nt(0) * nt(1),
+                 -nt(0) * nt(2), -nt(0) * nt(1), 1.0 - nt(1) * nt(1),
+                 -nt(1) * nt(2), -nt(0) * nt(2), -nt(1) * nt(2),
+                 1.0 - nt(2) * nt(2))
+                        .finished();
+
+        const Eigen::Vector3d &ditM = -dit.transpose() * M;
+        J_r[1].block<3, 1>(0, 0) = sqrt_lambda_photometric * vs.cross(ditM);
+        J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
+        r[1] = sqrt_lambda_photometric * (is - is0_proj);
+    };
 
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+    std::tie(JTJ, JTr, r2) = utility::ComputeFusedJTJandJTr<2>(
+            compute_jacobian_and_residual, (int)corres.size());
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
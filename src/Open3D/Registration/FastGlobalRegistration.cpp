@@ -26,6 +26,8 @@
 
 #include "Open3D/Registration/FastGlobalRegistration.h"
 
+#include <algorithm>
+
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
@@ -55,114 +57,117 @@ std::vector<std::pair<int, int>> AdvancedMatching(
     }
 
     // STEP 1) Initial matching
+    // Nearest feature of fi for every point of fj, then nearest feature of fj
+    // for every point of fi that was hit, both as batched searches.
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
     geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
     geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
+    std::vector<int> j_to_i;
     std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
+    feature_tree_i.SearchKNNBatch(features_vec[fj].data_, 1, j_to_i, dis);
+
     std::vector<int> i_to_j(nPti, -1);
+    std::vector<int> matched_i;
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+        int i = j_to_i[j];
+        if (i >= 0 && i_to_j[i] == -1) {
+            i_to_j[i] = 0;
+            matched_i.push_back(i);
         }
-        corres_ji.push_back(std::pair<int, int>(i, j));
     }
-    for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
+    std::sort(matched_i.begin(), matched_i.end());
+    int ncorres_ij = int(matched_i.size());
+    Eigen::MatrixXd matched_features_i(features_vec[fi].data_.rows(),
+                                       ncorres_ij);
+    for (int k = 0; k < ncorres_ij; k++) {
+        matched_features_i.col(k) = features_vec[fi].data_.col(matched_i[k]);
     }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
+    std::vector<int> matched_i_to_j;
+    feature_tree_j.SearchKNNBatch(matched_features_i, 1, matched_i_to_j, dis);
+    for (int k = 0; k < ncorres_ij; k++) {
+        i_to_j[matched_i[k]] = matched_i_to_j[k];
+    }
+    utility::LogDebug("points are remained : {:d}", ncorres_ij + nPtj);
 
     // STEP 2) CROSS CHECK
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
-    for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
+    for (int k = 0; k < ncorres_ij; k++) {
+        int i = matched_i[k];
+        int j = i_to_j[i];
+        if (j >= 0 && j_to_i[j] == i) {
+            corres_cross.push_back(std::pair<int, int>(i, j));
         }
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
+    // The trials are drawn and tested in parallel batches, and the tuples
+    // that pass are taken in trial order until there are enough of them.
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int i = 0, cnt = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
 
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
+    const int batch_size = 10000;
+    std::vector<Eigen::Vector3i> trials(batch_size);
+    std::vector<char> accepted(batch_size);
+    for (int batch_begin = 0;
+         batch_begin < number_of_trial && cnt < option.maximum_tuple_count_;
+         batch_begin += batch_size) {
+        int num_trials = std::min(batch_size, number_of_trial - batch_begin);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int t = 0; t < num_trials; t++) {
+            int rand0 = utility::UniformRandInt(0, ncorr - 1);
+            int rand1 = utility::UniformRandInt(0, ncorr - 1);
+            int rand2 = utility::UniformRandInt(0, ncorr - 1);
+            int idi0 = corres_cross[rand0].first;
+            int idj0 = corres_cross[rand0].second;
+            int idi1 = corres_cross[rand1].first;
+            int idj1 = corres_cross[rand1].second;
+            int idi2 = corres_cross[rand2].first;
+            int idj2 = corres_cross[rand2].second;
+
+            // collect 3 points from i-th fragment
+            const Eigen::Vector3d& pti0 = point_cloud_vec[fi].points_[idi0];
+            const Eigen::Vector3d& pti1 = point_cloud_vec[fi].points_[idi1];
+            const Eigen::Vector3d& pti2 = point_cloud_vec[fi].points_[idi2];
+            double li0 = (pti0 - pti1).norm();
+            double li1 = (pti1 - pti2).norm();
+            double li2 = (pti2 - pti0).norm();
+
+            // collect 3 points from j-th fragment
+            const Eigen::Vector3d& ptj0 = point_cloud_vec[fj].points_[idj0];
+            const Eigen::Vector3d& ptj1 = point_cloud_vec[fj].points_[idj1];
+            const Eigen::Vector3d& ptj2 = point_cloud_vec[fj].points_[idj2];
+            double lj0 = (ptj0 - ptj1).norm();
+            double lj1 = (ptj1 - ptj2).norm();
+            double lj2 = (ptj2 - ptj0).norm();
+
+            // check tuple constraint
+            trials[t] = Eigen::Vector3i(rand0, rand1, rand2);
+            accepted[t] = (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                          (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                          (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        i = batch_begin + num_trials;
+        for (int t = 0; t < num_trials; t++) {
+            if (accepted[t]) {
+                for (int k = 0; k < 3; k++) {
+                    corres_tuple.push_back(corres_cross[trials[t](k)]);
+                }
+                cnt++;
+            }
+            if (cnt >= option.maximum_tuple_count_) {
+                i = batch_begin + t;
+                break;
+            }
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
                       number_of_trial, i);
@@ -27,6 +27,7 @@
 #include "Open3D/Registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -51,7 +52,8 @@ Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     auto n2_copy = n2;
     double angle1 = n1_copy.dot(dp2p1) / result(3);
     double angle2 = n2_copy.dot(dp2p1) / result(3);
-    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
+    // acos is decreasing, compare the cosines instead of the angles.
+    if (fabs(angle1) < fabs(angle2)) {
         n1_copy = n2;
         n2_copy = n1;
         dp2p1 *= -1.0;
@@ -71,44 +73,112 @@ Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
-std::shared_ptr<Feature> ComputeSPFHFeature(
+/// Neighbors of all points in compressed sparse row layout, the neighbors of
+/// point i are indices_[offsets_[i], offsets_[i + 1]) sorted by distance.
+struct Neighborhoods {
+    std::vector<int> indices_;
+    std::vector<size_t> offsets_;
+};
+
+Neighborhoods SearchNeighborhoods(
         const geometry::PointCloud &input,
         const geometry::KDTreeFlann &kdtree,
         const geometry::KDTreeSearchParam &search_param) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+    typedef geometry::KDTreeSearchParam::SearchType SearchType;
+    // The points are searched in chunks to bound the size of the temporary
+    // distance buffers, only the indices are kept.
+    const int chunk_size = 1 << 16;
+    const int num_points = (int)input.points_.size();
+    Neighborhoods neighborhoods;
+    neighborhoods.offsets_.reserve(num_points + 1);
+    neighborhoods.offsets_.push_back(0);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<size_t> offsets;
+    std::vector<int> counts;
+    for (int begin = 0; begin < num_points; begin += chunk_size) {
+        const int n = std::min(chunk_size, num_points - begin);
+        Eigen::Map<const Eigen::MatrixXd> queries(
+                (const double *)input.points_[begin].data(), 3, n);
+        // Neighbors of query i are at indices[i * stride, ...) in the fixed
+        // stride layouts and at indices[offsets[i], offsets[i + 1]) otherwise.
+        int stride = 0;
+        int found = -1;
+        if (search_param.GetSearchType() == SearchType::Knn) {
+            const auto &param =
+                    (const geometry::KDTreeSearchParamKNN &)search_param;
+            stride = param.knn_;
+            found = kdtree.SearchKNNBatch(queries, stride, indices, distance2);
+        } else if (search_param.GetSearchType() == SearchType::Radius) {
+            const auto &param =
+                    (const geometry::KDTreeSearchParamRadius &)search_param;
+            found = kdtree.SearchRadiusBatch(queries, param.radius_, indices,
+                                             distance2, offsets);
+        } else if (search_param.GetSearchType() == SearchType::Hybrid) {
+            const auto &param =
+                    (const geometry::KDTreeSearchParamHybrid &)search_param;
+            stride = param.max_nn_;
+            found = kdtree.SearchHybridBatch(queries, param.radius_, stride,
+                                             indices, distance2, counts);
+        }
+        // Invalid search parameters leave every point without neighbors.
+        for (int i = 0; i < n; i++) {
+            if (found >= 0 && stride > 0) {
+                for (int k = 0; k < stride; k++) {
+                    int index = indices[size_t(i) * stride + k];
+                    if (index < 0) break;
+                    neighborhoods.indices_.push_back(index);
+                }
+            } else if (found >= 0) {
+                neighborhoods.indices_.insert(
+                        neighborhoods.indices_.end(),
+                        indices.begin() + offsets[i],
+                        indices.begin() + offsets[i + 1]);
+            }
+            neighborhoods.offsets_.push_back(neighborhoods.indices_.size());
+        }
+    }
+    return neighborhoods;
+}
+
+/// The SPFH histograms are only an intermediate of the FPFH computation and
+/// are kept in single precision.
+Eigen::MatrixXf ComputeSPFHFeature(const geometry::PointCloud &input,
+                                   const Neighborhoods &neighborhoods) {
+    Eigen::MatrixXf spfh = Eigen::MatrixXf::Zero(33, input.points_.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const size_t begin = neighborhoods.offsets_[i];
+        const size_t end = neighborhoods.offsets_[i + 1];
+        if (end - begin > 1) {
             // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
+            float hist_incr = float(100.0 / (double)(end - begin - 1));
+            for (size_t k = begin + 1; k < end; k++) {
                 // skip the point itself, compute histogram
+                const int index = neighborhoods.indices_[k];
                 auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
+                                              input.points_[index],
+                                              input.normals_[index]);
                 int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
+                spfh(h_index, i) += hist_incr;
                 h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
+                spfh(h_index + 11, i) += hist_incr;
                 h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
+                spfh(h_index + 22, i) += hist_incr;
             }
         }
     }
-    return feature;
+    return spfh;
 }
 
 }  // unnamed namespace
@@ -126,37 +196,39 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "normal.");
     }
     geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    // The neighborhoods are searched once and shared by both passes.
+    Neighborhoods neighborhoods =
+            SearchNeighborhoods(input, kdtree, search_param);
+    Eigen::MatrixXf spfh = ComputeSPFHFeature(input, neighborhoods);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+        const size_t begin = neighborhoods.offsets_[i];
+        const size_t end = neighborhoods.offsets_[i + 1];
+        if (end - begin > 1) {
+            Eigen::Matrix<double, 33, 1> weighted_spfh;
+            weighted_spfh.setZero();
+            for (size_t k = begin + 1; k < end; k++) {
                 // skip the point itself
-                double dist = distance2[k];
+                const int index = neighborhoods.indices_[k];
+                double dist = (input.points_[index] - point).squaredNorm();
                 if (dist == 0.0) continue;
-                for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
-                }
+                weighted_spfh += spfh.col(index).cast<double>() / dist;
             }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
+            for (int j = 0; j < 3; j++) {
+                double sum = weighted_spfh.segment<11>(11 * j).sum();
+                if (sum != 0.0) {
+                    weighted_spfh.segment<11>(11 * j) *= 100.0 / sum;
+                }
             }
+            // The commented line is the fpfh function in the paper.
+            // But according to PCL implementation, it is skipped.
+            // Our initial test shows that the full fpfh function in the
+            // paper seems to be better than PCL implementation. Further
+            // test required.
+            feature->data_.col(i) = weighted_spfh + spfh.col(i).cast<double>();
         }
     }
     return feature;
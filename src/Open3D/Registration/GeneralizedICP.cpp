@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GeneralizedICP.h"
+
+#include <Eigen/Dense>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+
+namespace {
+
+/// Covariance of a surface patch with normal \p normal.
+inline Eigen::Matrix3d ComputeCovarianceFromNormal(
+        const Eigen::Vector3d &normal, double epsilon) {
+    return Eigen::Matrix3d::Identity() -
+           (1.0 - epsilon) * normal * normal.transpose();
+}
+
+}  // unnamed namespace
+
+namespace registration {
+
+double TransformationEstimationForGeneralizedICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    if (corres.empty() || !source.HasNormals() || !target.HasNormals()) {
+        return 0.0;
+    }
+    double err = 0.0;
+    for (const auto &c : corres) {
+        const Eigen::Vector3d r = source.points_[c[0]] - target.points_[c[1]];
+        const Eigen::Matrix3d C =
+                ComputeCovarianceFromNormal(source.normals_[c[0]], epsilon_) +
+                ComputeCovarianceFromNormal(target.normals_[c[1]], epsilon_);
+        err += r.dot(C.ldlt().solve(r));
+    }
+    return std::sqrt(err / (double)corres.size());
+}
+
+Eigen::Matrix4d
+TransformationEstimationForGeneralizedICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    if (corres.empty() || !source.HasNormals() || !target.HasNormals()) {
+        return Eigen::Matrix4d::Identity();
+    }
+
+    // A null kernel, which Python allows to set, is the L2Loss.
+    L2Loss l2_loss;
+    const RobustKernel &kernel = kernel_ ? *kernel_ : l2_loss;
+
+    // The residual vs - vt is whitened by L^T, where L L^T is the inverse of
+    // the combined covariance, which gives three scalar residuals per
+    // correspondence. The kernel weights the Mahalanobis distance.
+    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d *J_r,
+                                             double *r) {
+        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
+        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
+        const Eigen::Matrix3d C =
+                ComputeCovarianceFromNormal(source.normals_[corres[i][0]],
+                                            epsilon_) +
+                ComputeCovarianceFromNormal(target.normals_[corres[i][1]],
+                                            epsilon_);
+        const Eigen::Matrix3d L = C.inverse().llt().matrixL();
+        const Eigen::Vector3d e = L.transpose() * (vs - vt);
+        const double sqrt_w = std::sqrt(kernel.Weight(e.norm()));
+        for (int k = 0; k < 3; k++) {
+            const Eigen::Vector3d l = sqrt_w * L.col(k);
+            r[k] = sqrt_w * e(k);
+            J_r[k].block<3, 1>(0, 0) = vs.cross(l);
+            J_r[k].block<3, 1>(3, 0) = l;
+        }
+    };
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) = utility::ComputeFusedJTJandJTr<3>(
+            compute_jacobian_and_residual, (int)corres.size());
+
+    bool is_success;
+    Eigen::Matrix4d extrinsic;
+    std::tie(is_success, extrinsic) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+
+    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+}
+
+RegistrationResult RegistrationGeneralizedICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimationForGeneralizedICP &estimation
+        /* = TransformationEstimationForGeneralizedICP()*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    return RegistrationICP(source, target, max_distance, init, estimation,
+                           criteria);
+}
+
+}  // namespace registration
+}  // namespace open3d
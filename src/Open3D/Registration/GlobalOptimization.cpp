@@ -31,6 +31,10 @@
 #include <tuple>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
 #include "Open3D/Registration/GlobalOptimizationMethod.h"
 #include "Open3D/Registration/PoseGraph.h"
@@ -139,8 +143,21 @@ std::tuple<Eigen::Matrix6d, Eigen::Matrix6d> GetJacobian(
     return std::make_tuple(std::move(Js), std::move(Jt));
 }
 
+/// Line process value of an edge with misalignment \p e, defined in
+/// [Choi et al 2015] See Eq (2). temp2 value in this function is derived from
+/// dE/dl = 0
+inline double ComputeLineProcess(const Eigen::Vector6d &e,
+                                 const Eigen::Matrix6d &information,
+                                 const double line_process_weight) {
+    double residual_square = e.transpose() * information * e;
+    double temp =
+            line_process_weight / (line_process_weight + residual_square);
+    double temp2 = temp * temp;
+    return temp2;
+}
+
 /// Function to update line_process value defined in [Choi et al 2015]
-/// See Eq (2). temp2 value in this function is derived from dE/dl = 0
+/// See Eq (2).
 int UpdateConfidence(PoseGraph &pose_graph,
                      const Eigen::VectorXd &zeta,
                      const double line_process_weight,
@@ -151,12 +168,10 @@ int UpdateConfidence(PoseGraph &pose_graph,
         PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         if (t.uncertain_) {
             Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
-            double residual_square = e.transpose() * t.information_ * e;
-            double temp = line_process_weight /
-                          (line_process_weight + residual_square);
-            double temp2 = temp * temp;
-            t.confidence_ = temp2;
-            if (temp2 > option.edge_prune_threshold_) valid_edges_num++;
+            t.confidence_ =
+                    ComputeLineProcess(e, t.information_, line_process_weight);
+            if (t.confidence_ > option.edge_prune_threshold_)
+                valid_edges_num++;
         }
     }
     return valid_edges_num;
@@ -246,6 +261,149 @@ std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Appends the coefficients of the 6x6 block \p block at (\p row, \p col)
+/// to \p triplets.
+inline Eigen::Triplet<double> *AddBlockTriplets(
+        int row,
+        int col,
+        const Eigen::Matrix6d &block,
+        Eigen::Triplet<double> *triplets) {
+    for (int c = 0; c < 6; c++) {
+        for (int r = 0; r < 6; r++) {
+            *triplets++ = Eigen::Triplet<double>(row + r, col + c, block(r, c));
+        }
+    }
+    return triplets;
+}
+
+/// Same linear system as ComputeLinearSystem, with H assembled as a sparse
+/// matrix of 6x6 blocks. The edges are linearized in parallel, every edge
+/// writes its four blocks to its own range of triplets and duplicates are
+/// summed when the matrix is assembled. The diagonal is always stored, so the
+/// sparsity pattern only depends on the edges of the graph.
+std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeSparseLinearSystem(const PoseGraph &pose_graph,
+                          const Eigen::VectorXd &zeta) {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    std::vector<Eigen::Triplet<double>> triplets(n_edges * 4 * 36 +
+                                                 n_nodes * 6);
+    Eigen::MatrixXd b_edges(12, n_edges);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+
+        Eigen::Matrix4d X_inv, Ts, Tt_inv;
+        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+
+        Eigen::Matrix6d Js, Jt;
+        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
+        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
+        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+        double line_process_iter = t.confidence_;
+
+        int id_i = t.source_node_id_ * 6;
+        int id_j = t.target_node_id_ * 6;
+        Eigen::Triplet<double> *edge_triplets =
+                triplets.data() + iter_edge * 4 * 36;
+        edge_triplets = AddBlockTriplets(
+                id_i, id_i, line_process_iter * JsT_Info * Js, edge_triplets);
+        edge_triplets = AddBlockTriplets(
+                id_i, id_j, line_process_iter * JsT_Info * Jt, edge_triplets);
+        edge_triplets = AddBlockTriplets(
+                id_j, id_i, line_process_iter * JtT_Info * Js, edge_triplets);
+        AddBlockTriplets(id_j, id_j, line_process_iter * JtT_Info * Jt,
+                         edge_triplets);
+        b_edges.block<6, 1>(0, iter_edge).noalias() =
+                -line_process_iter * Js.transpose() * eT_Info;
+        b_edges.block<6, 1>(6, iter_edge).noalias() =
+                -line_process_iter * Jt.transpose() * eT_Info;
+    }
+    for (int i = 0; i < n_nodes * 6; i++) {
+        triplets[n_edges * 4 * 36 + i] = Eigen::Triplet<double>(i, i, 0.0);
+    }
+
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::VectorXd b = Eigen::VectorXd::Zero(n_nodes * 6);
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        b.block<6, 1>(t.source_node_id_ * 6, 0) +=
+                b_edges.block<6, 1>(0, iter_edge);
+        b.block<6, 1>(t.target_node_id_ * 6, 0) +=
+                b_edges.block<6, 1>(6, iter_edge);
+    }
+    return std::make_tuple(std::move(H), std::move(b));
+}
+
+/// Solves H delta = b with the dense Hessian of ComputeLinearSystem.
+class DenseLinearSolver {
+public:
+    typedef Eigen::MatrixXd MatrixType;
+
+    static std::tuple<MatrixType, Eigen::VectorXd> BuildLinearSystem(
+            const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+        return ComputeLinearSystem(pose_graph, zeta);
+    }
+
+    static void AddToDiagonal(MatrixType &H, double lambda) {
+        H.diagonal().array() += lambda;
+    }
+
+    Eigen::VectorXd Solve(const MatrixType &H, const Eigen::VectorXd &b) {
+        bool solver_success = false;
+        Eigen::VectorXd delta;
+        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
+                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
+                /*check_det=*/false, /*check_psd=*/false);
+        return delta;
+    }
+};
+
+/// Solves H delta = b with the sparse block Hessian of
+/// ComputeSparseLinearSystem. The sparsity pattern does not change between
+/// iterations, so its symbolic analysis is done only once.
+class SparseLinearSolver {
+public:
+    typedef Eigen::SparseMatrix<double> MatrixType;
+
+    static std::tuple<MatrixType, Eigen::VectorXd> BuildLinearSystem(
+            const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+        return ComputeSparseLinearSystem(pose_graph, zeta);
+    }
+
+    static void AddToDiagonal(MatrixType &H, double lambda) {
+        for (int i = 0; i < H.rows(); i++) {
+            H.coeffRef(i, i) += lambda;
+        }
+    }
+
+    Eigen::VectorXd Solve(const MatrixType &H, const Eigen::VectorXd &b) {
+        if (!pattern_analyzed_) {
+            ldlt_.analyzePattern(H);
+            pattern_analyzed_ = true;
+        }
+        ldlt_.factorize(H);
+        if (ldlt_.info() == Eigen::Success) {
+            Eigen::VectorXd delta = ldlt_.solve(b);
+            if (ldlt_.info() == Eigen::Success) {
+                return delta;
+            }
+        }
+        utility::LogWarning("Sparse LDLT failed, switched to dense solver");
+        return Eigen::MatrixXd(H).ldlt().solve(b);
+    }
+
+private:
+    Eigen::SimplicialLDLT<MatrixType> ldlt_;
+    bool pattern_analyzed_ = false;
+};
+
 Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -339,18 +497,13 @@ bool CheckMaxIterationLM(
     return false;
 }
 
-double ComputeLineProcessWeight(const PoseGraph &pose_graph,
+double ComputeLineProcessWeight(int n_edges,
+                                double sum_number_of_correspondences,
                                 const GlobalOptimizationOption &option) {
-    int n_edges = (int)pose_graph.edges_.size();
-    double average_number_of_correspondences = 0.0;
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        double number_of_correspondences =
-                pose_graph.edges_[iter_edge].information_(5, 5);
-        average_number_of_correspondences += number_of_correspondences;
-    }
     if (n_edges > 0) {
         // see Section 5 in [Choi et al 2015]
-        average_number_of_correspondences /= (double)n_edges;
+        double average_number_of_correspondences =
+                sum_number_of_correspondences / (double)n_edges;
         double line_process_weight =
                 option.preference_loop_closure_ *
                 pow(option.max_correspondence_distance_, 2) *
@@ -361,6 +514,19 @@ double ComputeLineProcessWeight(const PoseGraph &pose_graph,
     }
 }
 
+double ComputeLineProcessWeight(const PoseGraph &pose_graph,
+                                const GlobalOptimizationOption &option) {
+    int n_edges = (int)pose_graph.edges_.size();
+    double sum_number_of_correspondences = 0.0;
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        double number_of_correspondences =
+                pose_graph.edges_[iter_edge].information_(5, 5);
+        sum_number_of_correspondences += number_of_correspondences;
+    }
+    return ComputeLineProcessWeight(n_edges, sum_number_of_correspondences,
+                                    option);
+}
+
 void CompensateReferencePoseGraphNode(PoseGraph &pose_graph_new,
                                       const PoseGraph &pose_graph_orig,
                                       int reference_node) {
@@ -460,37 +626,11 @@ bool ValidatePoseGraph(const PoseGraph &pose_graph) {
     return true;
 }
 
-}  // unnamed namespace
-
-namespace registration {
-std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
-        const PoseGraph &pose_graph, const GlobalOptimizationOption &option) {
-    std::shared_ptr<PoseGraph> pose_graph_pruned =
-            std::make_shared<PoseGraph>();
-
-    int n_nodes = (int)pose_graph.nodes_.size();
-    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
-        const PoseGraphNode &t = pose_graph.nodes_[iter_node];
-        pose_graph_pruned->nodes_.push_back(t);
-    }
-    int n_edges = (int)pose_graph.edges_.size();
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        if (t.uncertain_) {
-            if (t.confidence_ > option.edge_prune_threshold_) {
-                pose_graph_pruned->edges_.push_back(t);
-            }
-        } else {
-            pose_graph_pruned->edges_.push_back(t);
-        }
-    }
-    return pose_graph_pruned;
-}
-
-void GlobalOptimizationGaussNewton::OptimizePoseGraph(
+template <typename LinearSolver>
+void OptimizePoseGraphGaussNewton(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
+        const GlobalOptimizationOption &option) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
@@ -511,11 +651,12 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    LinearSolver solver;
+    typename LinearSolver::MatrixType H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = LinearSolver::BuildLinearSystem(pose_graph, zeta);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -529,13 +670,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        Eigen::VectorXd delta = solver.Solve(H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,7 +693,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            std::tie(H, b) = LinearSolver::BuildLinearSystem(pose_graph, zeta);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -579,10 +714,11 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             timer_overall.GetDuration() / 1000.0);
 }
 
-void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+template <typename LinearSolver>
+void OptimizePoseGraphLevenbergMarquardt(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
+        const GlobalOptimizationOption &option) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
@@ -602,12 +738,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    LinearSolver solver;
+    typename LinearSolver::MatrixType H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = LinearSolver::BuildLinearSystem(pose_graph, zeta);
 
     Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
@@ -629,14 +765,9 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
-
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            typename LinearSolver::MatrixType H_LM = H;
+            LinearSolver::AddToDiagonal(H_LM, current_lambda);
+            Eigen::VectorXd delta = solver.Solve(H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,7 +798,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    std::tie(H, b) =
+                            LinearSolver::BuildLinearSystem(pose_graph, zeta);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -696,6 +828,59 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                       timer_overall.GetDuration() / 1000.0);
 }
 
+}  // unnamed namespace
+
+namespace registration {
+std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
+        const PoseGraph &pose_graph, const GlobalOptimizationOption &option) {
+    std::shared_ptr<PoseGraph> pose_graph_pruned =
+            std::make_shared<PoseGraph>();
+
+    int n_nodes = (int)pose_graph.nodes_.size();
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        const PoseGraphNode &t = pose_graph.nodes_[iter_node];
+        pose_graph_pruned->nodes_.push_back(t);
+    }
+    int n_edges = (int)pose_graph.edges_.size();
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        if (t.uncertain_) {
+            if (t.confidence_ > option.edge_prune_threshold_) {
+                pose_graph_pruned->edges_.push_back(t);
+            }
+        } else {
+            pose_graph_pruned->edges_.push_back(t);
+        }
+    }
+    return pose_graph_pruned;
+}
+
+void GlobalOptimizationGaussNewton::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    if (option.use_dense_solver_) {
+        OptimizePoseGraphGaussNewton<DenseLinearSolver>(pose_graph, criteria,
+                                                        option);
+    } else {
+        OptimizePoseGraphGaussNewton<SparseLinearSolver>(pose_graph, criteria,
+                                                         option);
+    }
+}
+
+void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    if (option.use_dense_solver_) {
+        OptimizePoseGraphLevenbergMarquardt<DenseLinearSolver>(
+                pose_graph, criteria, option);
+    } else {
+        OptimizePoseGraphLevenbergMarquardt<SparseLinearSolver>(
+                pose_graph, criteria, option);
+    }
+}
+
 void GlobalOptimization(PoseGraph &pose_graph,
                         const GlobalOptimizationMethod &method
                         /* = GlobalOptimizationLevenbergMarquardt() */,
@@ -717,5 +902,271 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+int IncrementalPoseGraphOptimizer::AddNode(const PoseGraphNode &node) {
+    pose_graph_.nodes_.push_back(node);
+    node_edges_.emplace_back();
+    return (int)pose_graph_.nodes_.size() - 1;
+}
+
+int IncrementalPoseGraphOptimizer::AddEdge(const PoseGraphEdge &edge) {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    if (edge.source_node_id_ < 0 || edge.source_node_id_ >= n_nodes ||
+        edge.target_node_id_ < 0 || edge.target_node_id_ >= n_nodes ||
+        edge.source_node_id_ == edge.target_node_id_) {
+        utility::LogError(
+                "[IncrementalPoseGraphOptimizer] Edge ({:d}, {:d}) does not "
+                "join two different nodes of the graph.",
+                edge.source_node_id_, edge.target_node_id_);
+    }
+    int edge_id = (int)pose_graph_.edges_.size();
+    pose_graph_.edges_.push_back(edge);
+    node_edges_[edge.source_node_id_].push_back(edge_id);
+    node_edges_[edge.target_node_id_].push_back(edge_id);
+    sum_information_ += edge.information_(5, 5);
+    return edge_id;
+}
+
+const Eigen::Matrix4d_u &IncrementalPoseGraphOptimizer::GetPose(
+        int node_id) const {
+    if (node_id < 0 || node_id >= (int)pose_graph_.nodes_.size()) {
+        utility::LogError("[IncrementalPoseGraphOptimizer] Invalid node {:d}.",
+                          node_id);
+    }
+    return pose_graph_.nodes_[node_id].pose_;
+}
+
+int IncrementalPoseGraphOptimizer::GetAnchorNode() const {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    if (option_.reference_node_ >= 0 && option_.reference_node_ < n_nodes) {
+        return option_.reference_node_;
+    }
+    return 0;
+}
+
+void IncrementalPoseGraphOptimizer::LinearizeEdge(int edge_id) {
+    Eigen::Matrix4d X_inv, Ts, Tt_inv;
+    std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph_, edge_id);
+    Eigen::Matrix6d Js, Jt;
+    std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+    jacobians_source_[edge_id] = Js;
+    jacobians_target_[edge_id] = Jt;
+}
+
+void IncrementalPoseGraphOptimizer::VisitNeighborhood(
+        const std::vector<int> &seeds,
+        int max_edge_id,
+        std::vector<int> &visited) {
+    visit_stamp_++;
+    visited.clear();
+    for (int node : seeds) {
+        if (node_visits_[node] != visit_stamp_) {
+            node_visits_[node] = visit_stamp_;
+            visited.push_back(node);
+        }
+    }
+    // Breadth first, one ring of window_size_ rings per pass.
+    size_t ring_begin = 0;
+    for (int hop = 0; hop < window_size_; hop++) {
+        size_t ring_end = visited.size();
+        for (size_t k = ring_begin; k < ring_end; k++) {
+            for (int edge_id : node_edges_[visited[k]]) {
+                if (edge_id >= max_edge_id) continue;
+                const PoseGraphEdge &t = pose_graph_.edges_[edge_id];
+                int adjacent_node = t.source_node_id_ == visited[k]
+                                            ? t.target_node_id_
+                                            : t.source_node_id_;
+                if (node_visits_[adjacent_node] != visit_stamp_) {
+                    node_visits_[adjacent_node] = visit_stamp_;
+                    visited.push_back(adjacent_node);
+                }
+            }
+        }
+        if (ring_end == visited.size()) break;
+        ring_begin = ring_end;
+    }
+}
+
+std::vector<int> IncrementalPoseGraphOptimizer::SelectNodesToOptimize() {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    int n_edges = (int)pose_graph_.edges_.size();
+    std::vector<int> seeds, old_nodes;
+    for (int i = num_updated_nodes_; i < n_nodes; i++) {
+        seeds.push_back(i);
+    }
+    for (int j = num_updated_edges_; j < n_edges; j++) {
+        const PoseGraphEdge &t = pose_graph_.edges_[j];
+        for (int node : {t.source_node_id_, t.target_node_id_}) {
+            seeds.push_back(node);
+            if (node < num_updated_nodes_) old_nodes.push_back(node);
+        }
+    }
+
+    // The new edges close a loop if the nodes they join were not already
+    // within window_size_ edges of each other.
+    bool closes_loop = false;
+    std::vector<int> visited;
+    if (old_nodes.size() > 1) {
+        VisitNeighborhood({old_nodes[0]}, num_updated_edges_, visited);
+        for (int node : old_nodes) {
+            if (node_visits_[node] != visit_stamp_) closes_loop = true;
+        }
+    }
+    if (closes_loop) {
+        visited.resize(n_nodes);
+        for (int i = 0; i < n_nodes; i++) visited[i] = i;
+    } else {
+        VisitNeighborhood(seeds, n_edges, visited);
+    }
+
+    int anchor = GetAnchorNode();
+    std::vector<int> nodes;
+    for (int node : visited) {
+        if (node != anchor && !node_edges_[node].empty()) {
+            nodes.push_back(node);
+        }
+    }
+    utility::LogDebug(
+            "[IncrementalPoseGraphOptimizer] Optimizing {:d} of {:d} nodes{}.",
+            (int)nodes.size(), n_nodes, closes_loop ? " to close a loop" : "");
+    return nodes;
+}
+
+void IncrementalPoseGraphOptimizer::Optimize(const std::vector<int> &nodes) {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    int n_edges = (int)pose_graph_.edges_.size();
+    int n_variables = (int)nodes.size() * 6;
+    double line_process_weight =
+            ComputeLineProcessWeight(n_edges, sum_information_, option_);
+
+    // Local index of the optimized nodes, -1 for the fixed nodes, and the
+    // edges that touch at least one optimized node.
+    std::vector<int> local_index(n_nodes, -1);
+    for (size_t k = 0; k < nodes.size(); k++) {
+        local_index[nodes[k]] = (int)k * 6;
+    }
+    visit_stamp_++;
+    std::vector<int> edges;
+    for (int node : nodes) {
+        for (int edge_id : node_edges_[node]) {
+            if (edge_visits_[edge_id] != visit_stamp_) {
+                edge_visits_[edge_id] = visit_stamp_;
+                edges.push_back(edge_id);
+            }
+        }
+    }
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int iter = 0;; iter++) {
+        triplets.clear();
+        Eigen::VectorXd b = Eigen::VectorXd::Zero(n_variables);
+        for (int edge_id : edges) {
+            PoseGraphEdge &t = pose_graph_.edges_[edge_id];
+            Eigen::Matrix4d X_inv, Ts, Tt_inv;
+            std::tie(X_inv, Ts, Tt_inv) =
+                    GetRelativePoses(pose_graph_, edge_id);
+            Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
+            if (t.uncertain_) {
+                t.confidence_ = ComputeLineProcess(e, t.information_,
+                                                   line_process_weight);
+            }
+            const Eigen::Matrix6d Js = jacobians_source_[edge_id];
+            const Eigen::Matrix6d Jt = jacobians_target_[edge_id];
+            Eigen::Matrix6d JsT_Info =
+                    t.confidence_ * Js.transpose() * t.information_;
+            Eigen::Matrix6d JtT_Info =
+                    t.confidence_ * Jt.transpose() * t.information_;
+            Eigen::Vector6d Info_e = t.information_ * e;
+
+            int id_i = local_index[t.source_node_id_];
+            int id_j = local_index[t.target_node_id_];
+            size_t offset = triplets.size();
+            triplets.resize(offset + 36 * ((id_i >= 0) + (id_j >= 0)) *
+                                             ((id_i >= 0) + (id_j >= 0)));
+            Eigen::Triplet<double> *edge_triplets = triplets.data() + offset;
+            if (id_i >= 0) {
+                edge_triplets = AddBlockTriplets(id_i, id_i, JsT_Info * Js,
+                                                 edge_triplets);
+                b.block<6, 1>(id_i, 0) -= t.confidence_ * Js.transpose() *
+                                          Info_e;
+            }
+            if (id_j >= 0) {
+                edge_triplets = AddBlockTriplets(id_j, id_j, JtT_Info * Jt,
+                                                 edge_triplets);
+                b.block<6, 1>(id_j, 0) -= t.confidence_ * Jt.transpose() *
+                                          Info_e;
+            }
+            if (id_i >= 0 && id_j >= 0) {
+                edge_triplets = AddBlockTriplets(id_i, id_j, JsT_Info * Jt,
+                                                 edge_triplets);
+                AddBlockTriplets(id_j, id_i, JtT_Info * Js, edge_triplets);
+            }
+        }
+        if (CheckRightTerm(b, criteria_)) break;
+
+        // The edges and so the sparsity pattern do not change between the
+        // iterations.
+        Eigen::SparseMatrix<double> H(n_variables, n_variables);
+        H.setFromTriplets(triplets.begin(), triplets.end());
+        if (iter == 0) ldlt.analyzePattern(H);
+        ldlt.factorize(H);
+        if (ldlt.info() != Eigen::Success) {
+            utility::LogWarning(
+                    "[IncrementalPoseGraphOptimizer] Sparse LDLT failed, the "
+                    "graph may not be connected to its reference node.");
+            break;
+        }
+        Eigen::VectorXd delta = ldlt.solve(b);
+
+        Eigen::VectorXd x(n_variables);
+        for (size_t k = 0; k < nodes.size(); k++) {
+            x.block<6, 1>(k * 6, 0) = utility::TransformMatrix4dToVector6d(
+                    pose_graph_.nodes_[nodes[k]].pose_);
+        }
+        if (CheckRelativeIncrement(delta, x, criteria_)) break;
+
+        for (size_t k = 0; k < nodes.size(); k++) {
+            Eigen::Matrix4d_u &pose = pose_graph_.nodes_[nodes[k]].pose_;
+            pose = utility::TransformVector6dToMatrix4d(
+                           delta.block<6, 1>(k * 6, 0)) *
+                   pose;
+            Eigen::Matrix4d motion =
+                    pose * linearized_poses_[nodes[k]].inverse();
+            if (utility::TransformMatrix4dToVector6d(motion).norm() >
+                relinearize_threshold_) {
+                linearized_poses_[nodes[k]] = pose;
+                for (int edge_id : node_edges_[nodes[k]]) {
+                    LinearizeEdge(edge_id);
+                }
+            }
+        }
+        if (CheckMaxIteration(iter, criteria_)) break;
+    }
+}
+
+void IncrementalPoseGraphOptimizer::Update() {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    int n_edges = (int)pose_graph_.edges_.size();
+    if (num_updated_nodes_ == n_nodes && num_updated_edges_ == n_edges) {
+        return;
+    }
+    node_visits_.resize(n_nodes, 0);
+    edge_visits_.resize(n_edges, 0);
+    linearized_poses_.resize(n_nodes);
+    for (int i = num_updated_nodes_; i < n_nodes; i++) {
+        linearized_poses_[i] = pose_graph_.nodes_[i].pose_;
+    }
+    jacobians_source_.resize(n_edges);
+    jacobians_target_.resize(n_edges);
+    for (int j = num_updated_edges_; j < n_edges; j++) {
+        LinearizeEdge(j);
+    }
+
+    std::vector<int> nodes = SelectNodesToOptimize();
+    num_updated_nodes_ = n_nodes;
+    num_updated_edges_ = n_edges;
+    if (!nodes.empty()) Optimize(nodes);
+}
+
 }  // namespace registration
 }  // namespace open3d
@@ -27,15 +27,16 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
 #include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
 namespace registration {
 
-class PoseGraph;
-
 /// Function to optimize a PoseGraph
 /// Reference:
 /// [Kümmerle et al 2011]
@@ -61,5 +62,98 @@ void GlobalOptimization(
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
         const PoseGraph &pose_graph, const GlobalOptimizationOption &option);
 
+/// \class IncrementalPoseGraphOptimizer
+///
+/// \brief Pose graph optimizer for graphs that grow a few nodes and edges at a
+/// time, such as the keyframes of an online mapper.
+///
+/// Every call to Update() runs Gauss-Newton iterations on the nodes within
+/// window_size_ edges of the nodes and edges added since the previous call,
+/// the other nodes are held fixed. New edges that close a loop, i.e. join
+/// nodes that were further than window_size_ edges apart, optimize the whole
+/// graph instead. The Jacobians of the edges are cached and only recomputed
+/// when one of their nodes moved by more than relinearize_threshold_. Uncertain
+/// edges are weighted by the line process of [Choi et al 2015] but never
+/// pruned. The reference node of the option, or node 0 if it is not set, is
+/// the fixed gauge of the graph.
+class IncrementalPoseGraphOptimizer {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param criteria Convergence criteria of every Update().
+    /// \param option Line process and reference node options.
+    /// \param window_size Number of edges from the new nodes and edges within
+    /// which nodes are optimized.
+    /// \param relinearize_threshold Motion of a node, as the norm of its
+    /// 6D twist, beyond which the Jacobians of its edges are recomputed.
+    IncrementalPoseGraphOptimizer(
+            const GlobalOptimizationConvergenceCriteria &criteria =
+                    GlobalOptimizationConvergenceCriteria(),
+            const GlobalOptimizationOption &option =
+                    GlobalOptimizationOption(),
+            int window_size = 10,
+            double relinearize_threshold = 1e-3)
+        : criteria_(criteria),
+          option_(option),
+          window_size_(window_size),
+          relinearize_threshold_(relinearize_threshold) {}
+    ~IncrementalPoseGraphOptimizer() {}
+
+public:
+    /// Adds a node and returns its id. The node is optimized by the next call
+    /// to Update().
+    int AddNode(const PoseGraphNode &node);
+    /// Adds an edge between existing nodes and returns its id. The edge is
+    /// optimized by the next call to Update().
+    int AddEdge(const PoseGraphEdge &edge);
+    /// Optimizes the nodes affected by the nodes and edges added since the
+    /// previous call.
+    void Update();
+    /// Returns the current pose of node \p node_id.
+    const Eigen::Matrix4d_u &GetPose(int node_id) const;
+    /// Returns the current pose graph.
+    const PoseGraph &GetPoseGraph() const { return pose_graph_; }
+
+public:
+    /// Convergence criteria of every Update().
+    GlobalOptimizationConvergenceCriteria criteria_;
+    /// Line process and reference node options.
+    GlobalOptimizationOption option_;
+    /// Number of edges from the new nodes and edges within which nodes are
+    /// optimized.
+    int window_size_;
+    /// Motion of a node beyond which the Jacobians of its edges are
+    /// recomputed.
+    double relinearize_threshold_;
+
+private:
+    int GetAnchorNode() const;
+    void LinearizeEdge(int edge_id);
+    std::vector<int> SelectNodesToOptimize();
+    void VisitNeighborhood(const std::vector<int> &seeds,
+                           int max_edge_id,
+                           std::vector<int> &visited);
+    void Optimize(const std::vector<int> &nodes);
+
+private:
+    PoseGraph pose_graph_;
+    /// Edges of every node.
+    std::vector<std::vector<int>> node_edges_;
+    /// Node poses at which the Jacobians of their edges were last computed.
+    std::vector<Eigen::Matrix4d_u> linearized_poses_;
+    /// Cached Jacobians of every edge with respect to its two nodes.
+    std::vector<Eigen::Matrix6d_u> jacobians_source_;
+    std::vector<Eigen::Matrix6d_u> jacobians_target_;
+    /// Number of nodes and edges already seen by Update().
+    int num_updated_nodes_ = 0;
+    int num_updated_edges_ = 0;
+    /// Sum of information_(5, 5) of all edges, for the line process weight.
+    double sum_information_ = 0.0;
+    /// Visit marks of the nodes and edges, valid when equal to visit_stamp_.
+    std::vector<int> node_visits_;
+    std::vector<int> edge_visits_;
+    int visit_stamp_ = 0;
+};
+
 }  // namespace registration
 }  // namespace open3d
@@ -46,14 +46,18 @@ public:
     /// Recommendation: 0.1 for RGBD Odometry, 2.0 for fragment registration.
     /// \param reference_node The pose of this node is unchanged after
     /// optimization.
+    /// \param use_dense_solver Solves the normal equations with a dense
+    /// matrix instead of the sparse block Hessian.
     GlobalOptimizationOption(double max_correspondence_distance = 0.075,
                              double edge_prune_threshold = 0.25,
                              double preference_loop_closure = 1.0,
-                             int reference_node = -1)
+                             int reference_node = -1,
+                             bool use_dense_solver = false)
         : max_correspondence_distance_(max_correspondence_distance),
           edge_prune_threshold_(edge_prune_threshold),
           preference_loop_closure_(preference_loop_closure),
-          reference_node_(reference_node) {
+          reference_node_(reference_node),
+          use_dense_solver_(use_dense_solver) {
         max_correspondence_distance_ = max_correspondence_distance < 0.0
                                                ? 0.075
                                                : max_correspondence_distance;
@@ -82,6 +86,13 @@ public:
     double preference_loop_closure_;
     /// The pose of this node is unchanged after optimization.
     int reference_node_;
+    /// \brief Solves the normal equations with a dense matrix.
+    ///
+    /// By default the Hessian is assembled as a sparse matrix of 6x6 blocks
+    /// and factorized with a sparse Cholesky (LDLT) decomposition. The dense
+    /// path needs memory quadratic in the number of nodes and is kept for
+    /// comparison.
+    bool use_dense_solver_;
 };
 
 /// \class GlobalOptimizationConvergenceCriteria
@@ -26,12 +26,20 @@
 
 #include "Open3D/Registration/Registration.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
@@ -39,60 +47,178 @@ namespace open3d {
 namespace {
 using namespace registration;
 
-RegistrationResult GetRegistrationResultAndCorrespondences(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const geometry::KDTreeFlann &target_kdtree,
-        double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
-    RegistrationResult result(transformation);
-    if (max_correspondence_distance <= 0.0) {
-        return result;
-    }
+/// Nearest-neighbor correspondences between a source point cloud and a fixed
+/// target. Every source point gets a slot holding the index of its closest
+/// target point within the maximum distance, or -1 for none. The slots are
+/// filled in parallel over contiguous ranges of points and compacted in source
+/// order with a prefix sum over the per-thread counts. The buffers are kept
+/// between calls, so repeated searches such as ICP iterations do not allocate.
+class CorrespondenceSearch {
+public:
+    explicit CorrespondenceSearch(const geometry::KDTreeFlann &target_kdtree)
+        : target_kdtree_(target_kdtree) {}
 
-    double error2 = 0.0;
+    /// Fills \p result with the correspondences of \p source, already
+    /// transformed by \p transformation, and the resulting fitness and RMSE.
+    void Compute(const geometry::PointCloud &source,
+                 double max_correspondence_distance,
+                 const Eigen::Matrix4d &transformation,
+                 RegistrationResult &result) {
+        result.transformation_ = transformation;
+        result.correspondence_set_.clear();
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+        if (max_correspondence_distance <= 0.0) {
+            return;
+        }
 
+        const int num_points = (int)source.points_.size();
+        indices_.resize(num_points);
+        distance2_.resize(num_points);
+        int max_threads = 1;
 #ifdef _OPENMP
-#pragma omp parallel
-    {
+        max_threads = omp_get_max_threads();
 #endif
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
+        thread_offsets_.assign(max_threads + 1, 0);
+        thread_error2_.assign(max_threads, 0.0);
+
+        CorrespondenceSet &correspondence_set = result.correspondence_set_;
 #ifdef _OPENMP
-#pragma omp for nowait
+#pragma omp parallel num_threads(max_threads)
+#endif
+        {
+            int thread_id = 0;
+            int num_threads = 1;
+#ifdef _OPENMP
+            thread_id = omp_get_thread_num();
+            num_threads = omp_get_num_threads();
 #endif
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
+            const int begin = int(int64_t(num_points) * thread_id /
+                                  num_threads);
+            const int end = int(int64_t(num_points) * (thread_id + 1) /
+                                num_threads);
+            int count = 0;
+            double error2 = 0.0;
+            for (int i = begin; i < end; i++) {
+                if (target_kdtree_.SearchHybrid(
+                            source.points_[i], max_correspondence_distance, 1,
+                            &indices_[i], &distance2_[i]) > 0) {
+                    count++;
+                    error2 += distance2_[i];
+                } else {
+                    indices_[i] = -1;
+                }
             }
-        }
+            thread_offsets_[thread_id + 1] = count;
+            thread_error2_[thread_id] = error2;
 #ifdef _OPENMP
-#pragma omp critical
+#pragma omp barrier
+#pragma omp single
 #endif
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
+            {
+                for (int t = 0; t < num_threads; t++) {
+                    thread_offsets_[t + 1] += thread_offsets_[t];
+                }
+                correspondence_set.resize(thread_offsets_[num_threads]);
+            }
+            int offset = thread_offsets_[thread_id];
+            for (int i = begin; i < end; i++) {
+                if (indices_[i] >= 0) {
+                    correspondence_set[offset++] =
+                            Eigen::Vector2i(i, indices_[i]);
+                }
             }
-            error2 += error2_private;
         }
-#ifdef _OPENMP
+
+        if (!correspondence_set.empty()) {
+            double error2 = 0.0;
+            for (int t = 0; t < max_threads; t++) {
+                error2 += thread_error2_[t];
+            }
+            size_t corres_number = correspondence_set.size();
+            result.fitness_ = (double)corres_number / (double)num_points;
+            result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
+        }
     }
-#endif
 
-    if (result.correspondence_set_.empty()) {
-        result.fitness_ = 0.0;
-        result.inlier_rmse_ = 0.0;
-    } else {
-        size_t corres_number = result.correspondence_set_.size();
-        result.fitness_ = (double)corres_number / (double)source.points_.size();
-        result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
+private:
+    const geometry::KDTreeFlann &target_kdtree_;
+    std::vector<int> indices_;
+    std::vector<double> distance2_;
+    std::vector<int> thread_offsets_;
+    std::vector<double> thread_error2_;
+};
+
+RegistrationResult GetRegistrationResultAndCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
+    RegistrationResult result(transformation);
+    CorrespondenceSearch(target_kdtree)
+            .Compute(source, max_correspondence_distance, transformation,
+                     result);
+    return result;
+}
+
+void CheckICPInput(const geometry::PointCloud &source,
+                   const geometry::PointCloud &target,
+                   double max_correspondence_distance,
+                   const TransformationEstimation &estimation) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    if ((estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::PointToPlane ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::ColoredICP ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::GeneralizedICP) &&
+        (!source.HasNormals() || !target.HasNormals())) {
+        utility::LogError(
+                "TransformationEstimationPointToPlane, "
+                "TransformationEstimationColoredICP and "
+                "TransformationEstimationForGeneralizedICP "
+                "require pre-computed normal vectors.");
+    }
+}
+
+/// ICP iterations of \p pcd, the source already transformed by \p init,
+/// against \p target indexed by \p target_kdtree. \p pcd is transformed in
+/// place.
+RegistrationResult RegistrationICPInPlace(
+        geometry::PointCloud &pcd,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    Eigen::Matrix4d transformation = init;
+    // The correspondence buffers, and the capacity of the two results, are
+    // reused by all iterations.
+    CorrespondenceSearch correspondence_search(target_kdtree);
+    RegistrationResult result;
+    RegistrationResult backup;
+    correspondence_search.Compute(pcd, max_correspondence_distance,
+                                  transformation, result);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        Eigen::Matrix4d update = estimation.ComputeTransformation(
+                pcd, target, result.correspondence_set_);
+        transformation = update * transformation;
+        pcd.Transform(update);
+        backup = result;
+        correspondence_search.Compute(pcd, max_correspondence_distance,
+                                      transformation, result);
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
     }
     return result;
 }
@@ -126,6 +252,37 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+/// Counts the points of \p source that have a point of the target within
+/// \p max_correspondence_distance once transformed by \p transformation, and
+/// accumulates their squared distances into \p error2. Returns -1 as soon as
+/// fewer than \p min_inliers inliers can be reached.
+int CountRANSACInliers(const geometry::PointCloud &source,
+                       const geometry::KDTreeFlann &target_kdtree,
+                       double max_correspondence_distance,
+                       const Eigen::Matrix4d &transformation,
+                       int min_inliers,
+                       double &error2) {
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    const int num_points = (int)source.points_.size();
+    int inliers = 0;
+    error2 = 0.0;
+    for (int i = 0; i < num_points; i++) {
+        if (inliers + (num_points - i) < min_inliers) {
+            return -1;
+        }
+        int index;
+        double dist2;
+        const Eigen::Vector3d point = R * source.points_[i] + t;
+        if (target_kdtree.SearchHybrid(point, max_correspondence_distance, 1,
+                                       &index, &dist2) > 0) {
+            inliers++;
+            error2 += dist2;
+        }
+    }
+    return inliers;
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -154,51 +311,117 @@ RegistrationResult RegistrationICP(
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
-    if (max_correspondence_distance <= 0.0) {
-        utility::LogError("Invalid max_correspondence_distance.");
-    }
-    if ((estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::PointToPlane ||
-         estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::ColoredICP) &&
-        (!source.HasNormals() || !target.HasNormals())) {
-        utility::LogError(
-                "TransformationEstimationPointToPlane and "
-                "TransformationEstimationColoredICP "
-                "require pre-computed normal vectors.");
-    }
+    CheckICPInput(source, target, max_correspondence_distance, estimation);
 
-    Eigen::Matrix4d transformation = init;
     geometry::KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (init.isIdentity() == false) {
         pcd.Transform(init);
     }
-    RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
-    for (int i = 0; i < criteria.max_iteration_; i++) {
-        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
-                          result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
-        transformation = update * transformation;
-        pcd.Transform(update);
-        RegistrationResult backup = result;
-        result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
-        if (std::abs(backup.fitness_ - result.fitness_) <
-                    criteria.relative_fitness_ &&
-            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
-                    criteria.relative_rmse_) {
-            break;
+    return RegistrationICPInPlace(pcd, target, kdtree,
+                                  max_correspondence_distance, init, estimation,
+                                  criteria);
+}
+
+PointCloudPyramid::PointCloudPyramid(const geometry::PointCloud &cloud,
+                                     const std::vector<double> &voxel_sizes,
+                                     bool estimate_normals /* = false*/)
+    : voxel_sizes_(voxel_sizes) {
+    for (double voxel_size : voxel_sizes_) {
+        if (voxel_size < 0.0) {
+            utility::LogError("Invalid voxel_size {:f}.", voxel_size);
+        }
+        std::shared_ptr<geometry::PointCloud> level =
+                voxel_size > 0.0
+                        ? cloud.VoxelDownSample(voxel_size)
+                        : std::make_shared<geometry::PointCloud>(cloud);
+        if (estimate_normals) {
+            if (voxel_size > 0.0) {
+                level->EstimateNormals(geometry::KDTreeSearchParamHybrid(
+                        voxel_size * 2.0, 30));
+            } else {
+                level->EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+            }
+        }
+        // The level is owned by the pyramid, so the KD-tree can index it in
+        // place.
+        auto kdtree = std::make_shared<geometry::KDTreeFlann>();
+        kdtree->SetGeometryInPlace(*level);
+        levels_.push_back(level);
+        kdtrees_.push_back(kdtree);
+    }
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const PointCloudPyramid &target_pyramid,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const std::vector<ICPConvergenceCriteria> &criteria /* = {}*/) {
+    const size_t num_levels = target_pyramid.NumLevels();
+    if (max_correspondence_distances.size() != num_levels) {
+        utility::LogError(
+                "max_correspondence_distances has {:d} values for {:d} "
+                "levels.",
+                max_correspondence_distances.size(), num_levels);
+    }
+    if (!criteria.empty() && criteria.size() != num_levels) {
+        utility::LogError("criteria has {:d} values for {:d} levels.",
+                          criteria.size(), num_levels);
+    }
+
+    RegistrationResult result(init);
+    for (size_t level = 0; level < num_levels; level++) {
+        const geometry::PointCloud &target = target_pyramid.GetLevel(level);
+        const double voxel_size = target_pyramid.GetVoxelSizes()[level];
+        CheckICPInput(source, target, max_correspondence_distances[level],
+                      estimation);
+
+        // The downsampled source is a new cloud, so ICP can transform it in
+        // place.
+        std::shared_ptr<geometry::PointCloud> pcd =
+                voxel_size > 0.0
+                        ? source.VoxelDownSample(voxel_size)
+                        : std::make_shared<geometry::PointCloud>(source);
+        const Eigen::Matrix4d transformation = result.transformation_;
+        if (transformation.isIdentity() == false) {
+            pcd->Transform(transformation);
         }
+        result = RegistrationICPInPlace(
+                *pcd, target, target_pyramid.GetKDTree(level),
+                max_correspondence_distances[level], transformation,
+                estimation,
+                criteria.empty() ? ICPConvergenceCriteria() : criteria[level]);
+        utility::LogDebug(
+                "Multi-scale ICP level #{:d}: Fitness {:.4f}, RMSE {:.4f}",
+                level, result.fitness_, result.inlier_rmse_);
     }
     return result;
 }
 
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const std::vector<ICPConvergenceCriteria> &criteria /* = {}*/) {
+    PointCloudPyramid target_pyramid(
+            target, voxel_sizes,
+            estimation.GetTransformationEstimationType() ==
+                            TransformationEstimationType::PointToPlane ||
+                    estimation.GetTransformationEstimationType() ==
+                            TransformationEstimationType::GeneralizedICP);
+    return RegistrationMultiScaleICP(source, target_pyramid,
+                                     max_correspondence_distances, init,
+                                     estimation, criteria);
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -259,52 +482,69 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         return RegistrationResult();
     }
 
-    RegistrationResult result;
-    int total_validation = 0;
-    bool finished_validation = false;
-    int num_similar_features = 1;
-    std::vector<std::vector<int>> similar_features(source.points_.size());
+    if (source.points_.empty() || target.points_.empty()) {
+        return RegistrationResult();
+    }
 
-#ifdef _OPENMP
-#pragma omp parallel
+    // Shared, read-only target index and the feature correspondence of every
+    // source point, both built once before the hypotheses are sampled.
+    geometry::KDTreeFlann kdtree(target);
+    const int num_similar_features = 1;
+    std::vector<int> similar_features;
     {
-#endif
-        CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
         geometry::KDTreeFlann kdtree_feature(target_feature);
-        RegistrationResult result_private;
+        std::vector<double> dists;
+        kdtree_feature.SearchKNNBatch(source_feature.data_,
+                                      num_similar_features, similar_features,
+                                      dists);
+    }
 
+    // Hypotheses are generated and scored in batches. The transformations of
+    // a batch are estimated in parallel, the ones passing the checkers are
+    // validated in parallel against the best result of the previous batches,
+    // and the batch is reduced in iteration order.
+    const int batch_size = 1000;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations(
+            batch_size);
+    std::vector<char> valid(batch_size);
+    std::vector<int> candidates;
+    std::vector<int> candidate_inliers;
+    std::vector<double> candidate_error2;
+
+    int total_validation = 0;
+    int best_inliers = 0;
+    double best_error2 = 0.0;
+    Eigen::Matrix4d best_transformation = Eigen::Matrix4d::Identity();
+    for (int itr_begin = 0; itr_begin < criteria.max_iteration_ &&
+                            total_validation < criteria.max_validation_;
+         itr_begin += batch_size) {
+        const int num_itr =
+                std::min(batch_size, criteria.max_iteration_ - itr_begin);
 #ifdef _OPENMP
-#pragma omp for nowait
+#pragma omp parallel
+        {
 #endif
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (!finished_validation) {
-                std::vector<double> dists(num_similar_features);
-                Eigen::Matrix4d transformation;
+            CorrespondenceSet ransac_corres(ransac_n);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int itr = 0; itr < num_itr; itr++) {
+                Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
                 for (int j = 0; j < ransac_n; j++) {
                     int source_sample_id = utility::UniformRandInt(
                             0, static_cast<int>(source.points_.size()) - 1);
-                    if (similar_features[source_sample_id].empty()) {
-                        std::vector<int> indices(num_similar_features);
-                        kdtree_feature.SearchKNN(
-                                Eigen::VectorXd(source_feature.data_.col(
-                                        source_sample_id)),
-                                num_similar_features, indices, dists);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                        { similar_features[source_sample_id] = indices; }
-                    }
                     ransac_corres[j](0) = source_sample_id;
-                    if (num_similar_features == 1)
+                    if (num_similar_features == 1) {
                         ransac_corres[j](1) =
-                                similar_features[source_sample_id][0];
-                    else {
+                                similar_features[source_sample_id];
+                    } else {
                         ransac_corres[j](1) = similar_features
-                                [source_sample_id][utility::UniformRandInt(
-                                        0, num_similar_features - 1)];
+                                [source_sample_id * num_similar_features +
+                                 utility::UniformRandInt(
+                                         0, num_similar_features - 1)];
                     }
                 }
+                valid[itr] = 0;
                 bool check = true;
                 for (const auto &checker : checkers) {
                     if (checker.get().require_pointcloud_alignment_ == false &&
@@ -317,7 +557,6 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 if (check == false) continue;
                 transformation = estimation.ComputeTransformation(
                         source, target, ransac_corres);
-                check = true;
                 for (const auto &checker : checkers) {
                     if (checker.get().require_pointcloud_alignment_ == true &&
                         checker.get().Check(source, target, ransac_corres,
@@ -327,39 +566,54 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                     }
                 }
                 if (check == false) continue;
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto this_result = GetRegistrationResultAndCorrespondences(
-                        pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
-                if (this_result.fitness_ > result_private.fitness_ ||
-                    (this_result.fitness_ == result_private.fitness_ &&
-                     this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
-                    result_private = this_result;
-                }
+                transformations[itr] = transformation;
+                valid[itr] = 1;
+            }
 #ifdef _OPENMP
-#pragma omp critical
+        }
 #endif
-                {
-                    total_validation = total_validation + 1;
-                    if (total_validation >= criteria.max_validation_)
-                        finished_validation = true;
-                }
-            }  // end of if statement
-        }      // end of for-loop
+
+        candidates.clear();
+        for (int itr = 0; itr < num_itr &&
+                          total_validation < criteria.max_validation_;
+             itr++) {
+            if (valid[itr]) {
+                candidates.push_back(itr);
+                total_validation++;
+            }
+        }
+        const int num_candidates = (int)candidates.size();
+        candidate_inliers.resize(num_candidates);
+        candidate_error2.resize(num_candidates);
 #ifdef _OPENMP
-#pragma omp critical
+#pragma omp parallel for schedule(dynamic)
 #endif
-        {
-            if (result_private.fitness_ > result.fitness_ ||
-                (result_private.fitness_ == result.fitness_ &&
-                 result_private.inlier_rmse_ < result.inlier_rmse_)) {
-                result = result_private;
+        for (int c = 0; c < num_candidates; c++) {
+            candidate_inliers[c] = CountRANSACInliers(
+                    source, kdtree, max_correspondence_distance,
+                    transformations[candidates[c]], best_inliers,
+                    candidate_error2[c]);
+        }
+        for (int c = 0; c < num_candidates; c++) {
+            if (candidate_inliers[c] > best_inliers ||
+                (candidate_inliers[c] > 0 &&
+                 candidate_inliers[c] == best_inliers &&
+                 candidate_error2[c] < best_error2)) {
+                best_inliers = candidate_inliers[c];
+                best_error2 = candidate_error2[c];
+                best_transformation = transformations[candidates[c]];
             }
         }
-#ifdef _OPENMP
     }
-#endif
+
+    RegistrationResult result;
+    if (best_inliers > 0) {
+        geometry::PointCloud pcd = source;
+        pcd.Transform(best_transformation);
+        result = GetRegistrationResultAndCorrespondences(
+                pcd, target, kdtree, max_correspondence_distance,
+                best_transformation);
+    }
     utility::LogDebug("total_validation : {:d}", total_validation);
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -37,8 +38,9 @@
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
 class PointCloud;
-}
+}  // namespace geometry
 
 namespace registration {
 class Feature;
@@ -164,6 +166,96 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \class PointCloudPyramid
+///
+/// \brief Voxel downsampled levels of a point cloud, each with its KD-tree.
+///
+/// Building the pyramid of a target once and passing it to
+/// RegistrationMultiScaleICP skips the downsampling, the normal estimation and
+/// the KD-tree construction of the target in every registration against it.
+class PointCloudPyramid {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud The point cloud.
+    /// \param voxel_sizes Voxel size of every level, from the coarsest to the
+    /// finest. A voxel size of 0 keeps the point cloud at full resolution.
+    /// \param estimate_normals Estimate the normals of every level, as needed
+    /// by a target of TransformationEstimationPointToPlane.
+    PointCloudPyramid(const geometry::PointCloud &cloud,
+                      const std::vector<double> &voxel_sizes,
+                      bool estimate_normals = false);
+    ~PointCloudPyramid() {}
+
+public:
+    /// Returns the number of levels.
+    size_t NumLevels() const { return levels_.size(); }
+    /// Returns the voxel size of every level.
+    const std::vector<double> &GetVoxelSizes() const { return voxel_sizes_; }
+    /// Returns the point cloud of level \p level.
+    const geometry::PointCloud &GetLevel(size_t level) const {
+        return *levels_[level];
+    }
+    /// Returns the KD-tree of level \p level.
+    const geometry::KDTreeFlann &GetKDTree(size_t level) const {
+        return *kdtrees_[level];
+    }
+
+private:
+    std::vector<double> voxel_sizes_;
+    std::vector<std::shared_ptr<geometry::PointCloud>> levels_;
+    std::vector<std::shared_ptr<geometry::KDTreeFlann>> kdtrees_;
+};
+
+/// \brief Function for coarse-to-fine ICP registration against a target
+/// pyramid.
+///
+/// Runs ICP at every level of \p target_pyramid, from the coarsest to the
+/// finest, starting from the transformation found at the previous level. The
+/// source is downsampled with the voxel size of each level.
+///
+/// \param source The source point cloud.
+/// \param target_pyramid The pyramid of the target point cloud.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of every level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria of every level. The default criteria
+/// are used at every level if empty.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const PointCloudPyramid &target_pyramid,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const std::vector<ICPConvergenceCriteria> &criteria = {});
+
+/// \brief Function for coarse-to-fine ICP registration.
+///
+/// Builds the pyramid of \p target, with normals for
+/// TransformationEstimationPointToPlane, and registers \p source against it.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel size of every level, from the coarsest to the
+/// finest.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of every level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria of every level. The default criteria
+/// are used at every level if empty.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const std::vector<ICPConvergenceCriteria> &criteria = {});
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace registration {
+
+/// \class RobustKernel
+///
+/// Base class of the robust kernels used to down-weight outlier residuals in
+/// iteratively reweighted least squares. The weight of a residual r is
+/// w(r) = rho'(r) / r for the kernel loss rho.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+
+public:
+    /// Returns the weight of the given residual.
+    ///
+    /// \param residual The residual of a correspondence.
+    virtual double Weight(double residual) const = 0;
+};
+
+/// \class L2Loss
+///
+/// Plain least squares, all residuals are weighted equally.
+class L2Loss : public RobustKernel {
+public:
+    double Weight(double residual) const override;
+};
+
+/// \class HuberLoss
+///
+/// Quadratic for residuals up to \p k and linear beyond.
+class HuberLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residual where the loss becomes linear.
+    explicit HuberLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Residual where the loss becomes linear.
+    double k_;
+};
+
+/// \class CauchyLoss
+///
+/// Logarithmic loss, large residuals keep a weight that decays as 1 / r^2.
+class CauchyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the residuals.
+    explicit CauchyLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Scale of the residuals.
+    double k_;
+};
+
+/// \class TukeyLoss
+///
+/// Tukey's biweight, residuals beyond \p k are ignored.
+class TukeyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residual beyond which the weight is zero.
+    explicit TukeyLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Residual beyond which the weight is zero.
+    double k_;
+};
+
+}  // namespace registration
+}  // namespace open3d
@@ -81,22 +81,29 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     if (corres.empty() || target.HasNormals() == false)
         return Eigen::Matrix4d::Identity();
 
-    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r) {
+    // A null kernel, which Python allows to set, is the L2Loss.
+    L2Loss l2_loss;
+    const RobustKernel &kernel = kernel_ ? *kernel_ : l2_loss;
+
+    // The kernel weight w is applied as sqrt(w) to both the residual and its
+    // Jacobian, so that JTJ and JTr are the weighted normal equations.
+    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d *J_r,
+                                             double *r) {
         const Eigen::Vector3d &vs = source.points_[corres[i][0]];
         const Eigen::Vector3d &vt = target.points_[corres[i][1]];
         const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
-        r = (vs - vt).dot(nt);
-        J_r.block<3, 1>(0, 0) = vs.cross(nt);
-        J_r.block<3, 1>(3, 0) = nt;
+        r[0] = (vs - vt).dot(nt);
+        const double sqrt_w = std::sqrt(kernel.Weight(r[0]));
+        r[0] *= sqrt_w;
+        J_r[0].block<3, 1>(0, 0) = sqrt_w * vs.cross(nt);
+        J_r[0].block<3, 1>(3, 0) = sqrt_w * nt;
     };
 
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+    std::tie(JTJ, JTr, r2) = utility::ComputeFusedJTJandJTr(
+            compute_jacobian_and_residual, (int)corres.size());
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -31,6 +31,10 @@
 #include <tuple>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Eigen {
 
 /// Extending Eigen namespace by adding frequently used matrix type
@@ -113,6 +117,72 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Function to compute JTJ and JTr of a 6-parameter problem, with the functor
+/// inlined instead of called through std::function.
+/// Input: functor f and number of elements
+/// Output: JTJ, JTr, sum of r^2
+/// Note: f(i, J_r, r) writes the NumResiduals residuals of element i to the
+/// array r and their Jacobian rows to the array J_r. Each thread accumulates
+/// the upper triangle of JTJ only, and the per-thread sums are added pairwise.
+template <int NumResiduals = 1, typename FuncType>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeFusedJTJandJTr(
+        FuncType f, int iteration_num) {
+    // Upper triangle of JTJ in row-major order, then JTr, then r^2.
+    typedef Eigen::Matrix<double, 28, 1> Reduction;
+    int max_threads = 1;
+#ifdef _OPENMP
+    max_threads = omp_get_max_threads();
+#endif
+    std::vector<Reduction, Eigen::aligned_allocator<Reduction>> partials(
+            max_threads, Reduction::Zero());
+#ifdef _OPENMP
+#pragma omp parallel num_threads(max_threads)
+#endif
+    {
+        int thread_id = 0;
+#ifdef _OPENMP
+        thread_id = omp_get_thread_num();
+#endif
+        double sum[28] = {0.0};
+        Eigen::Vector6d J_r[NumResiduals];
+        double r[NumResiduals];
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r);
+            for (int k = 0; k < NumResiduals; k++) {
+                int idx = 0;
+                for (int row = 0; row < 6; row++) {
+                    for (int col = row; col < 6; col++) {
+                        sum[idx++] += J_r[k](row) * J_r[k](col);
+                    }
+                }
+                for (int row = 0; row < 6; row++) {
+                    sum[21 + row] += J_r[k](row) * r[k];
+                }
+                sum[27] += r[k] * r[k];
+            }
+        }
+        partials[thread_id] = Eigen::Map<const Reduction>(sum);
+    }
+    for (int stride = 1; stride < max_threads; stride *= 2) {
+        for (int t = 0; t + stride < max_threads; t += 2 * stride) {
+            partials[t] += partials[t + stride];
+        }
+    }
+
+    Eigen::Matrix6d JTJ;
+    int idx = 0;
+    for (int row = 0; row < 6; row++) {
+        for (int col = row; col < 6; col++) {
+            JTJ(row, col) = JTJ(col, row) = partials[0](idx++);
+        }
+    }
+    Eigen::Vector6d JTr = partials[0].segment<6>(21);
+    return std::make_tuple(std::move(JTJ), std::move(JTr), partials[0](27));
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
@@ -130,6 +130,7 @@ bool VisualizerWithVertexSelection::AddGeometry(
         /// TODO(Akash): Ask wei whether something needs to be added here
         case geometry::Geometry::GeometryType::TriangleMeshCuda:
         case geometry::Geometry::GeometryType::PointCloudCuda:
+        case geometry::Geometry::GeometryType::PointCloudFloat:
         case geometry::Geometry::GeometryType::ImageCuda:
         case geometry::Geometry::GeometryType::MeshBase:
             // MeshBase is too general, can't render. Fall-through.
@@ -228,6 +229,7 @@ bool VisualizerWithVertexSelection::UpdateGeometry(
         /// TODO(Akash): Ask wei
         case geometry::Geometry::GeometryType::TriangleMeshCuda:
         case geometry::Geometry::GeometryType::PointCloudCuda:
+        case geometry::Geometry::GeometryType::PointCloudFloat:
         case geometry::Geometry::GeometryType::ImageCuda:
         case geometry::Geometry::GeometryType::Image:
         case geometry::Geometry::GeometryType::RGBDImage:
@@ -798,6 +800,7 @@ const std::vector<Eigen::Vector3d>
         ///TODO(Akash): Ask wei
         case geometry::Geometry::GeometryType::TriangleMeshCuda:
         case geometry::Geometry::GeometryType::PointCloudCuda:
+        case geometry::Geometry::GeometryType::PointCloudFloat:
         case geometry::Geometry::GeometryType::ImageCuda:
         case geometry::Geometry::GeometryType::Image:
         case geometry::Geometry::GeometryType::RGBDImage:
@@ -201,6 +201,17 @@ void pybind_kdtreeflann(py::module &m) {
                      return std::make_tuple(k, indices, distance2);
                  },
                  "query"_a, "radius"_a, "max_nn"_a)
+            .def("count_radius_vector_3d",
+                 [](const geometry::KDTreeFlann &tree,
+                    const Eigen::Vector3d &query, double radius,
+                    int max_count) {
+                     int k = tree.CountRadius(query, radius, max_count);
+                     if (k < 0)
+                         throw std::runtime_error(
+                                 "count_radius_vector_3d() error!");
+                     return k;
+                 },
+                 "query"_a, "radius"_a, "max_count"_a = 0)
             .def("search_vector_xd",
                  [](const geometry::KDTreeFlann &tree,
                     const Eigen::VectorXd &query,
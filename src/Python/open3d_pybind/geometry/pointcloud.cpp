@@ -62,6 +62,9 @@ void pybind_pointcloud(py::module &m) {
                  "Returns ``True`` if the point cloud contains point normals.")
             .def("has_colors", &geometry::PointCloud::HasColors,
                  "Returns ``True`` if the point cloud contains point colors.")
+            .def("is_organized", &geometry::PointCloud::IsOrganized,
+                 "Returns ``True`` if the points are laid out on a width x "
+                 "height pixel grid.")
             .def("normalize_normals", &geometry::PointCloud::NormalizeNormals,
                  "Normalize point normals to length 1.")
             .def("paint_uniform_color",
@@ -114,6 +117,13 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
+            .def("remove_radius_outlier_organized",
+                 &geometry::PointCloud::RemoveRadiusOutliersOrganized,
+                 "Function to remove points of an organized point cloud that "
+                 "have less than nb_points in a given sphere of a given "
+                 "radius among the pixels of a window. Removed points are set "
+                 "to NaN.",
+                 "nb_points"_a, "radius"_a, "window_radius"_a = 2)
             .def("remove_statistical_outlier",
                  &geometry::PointCloud::RemoveStatisticalOutliers,
                  "Function to remove points that are further away from their "
@@ -125,6 +135,17 @@ void pybind_pointcloud(py::module &m) {
                  "normals exist",
                  "search_param"_a = geometry::KDTreeSearchParamKNN(),
                  "fast_normal_computation"_a = true)
+            .def("estimate_normals_organized",
+                 &geometry::PointCloud::EstimateNormalsOrganized,
+                 "Function to compute the normals of an organized point cloud "
+                 "from the neighboring pixels of every point.",
+                 "window_radius"_a = 2, "max_neighbor_distance"_a = 0.05,
+                 "fast_normal_computation"_a = true)
+            .def("down_sample_organized",
+                 &geometry::PointCloud::DownSampleOrganized,
+                 "Function to downsample an organized point cloud by "
+                 "averaging blocks of pixels.",
+                 "block_size"_a)
             .def("orient_normals_to_align_with_direction",
                  &geometry::PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -175,7 +196,16 @@ void pybind_pointcloud(py::module &m) {
             .def("segment_plane", &geometry::PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999, "num_scoring_points"_a = 0)
+            .def("segment_planes", &geometry::PointCloud::SegmentPlanes,
+                 "Segments several planes in the point cloud one after the "
+                 "other, each one from the points left by the previous ones, "
+                 "using the RANSAC algorithm.",
+                 "num_planes"_a, "distance_threshold"_a = 0.01,
+                 "ransac_n"_a = 3, "num_iterations"_a = 100,
+                 "probability"_a = 0.99999999, "num_scoring_points"_a = 0,
+                 "min_num_inliers"_a = 0)
             .def_static(
                     "create_from_depth_image",
                     &geometry::PointCloud::CreateFromDepthImage,
@@ -214,8 +244,15 @@ void pybind_pointcloud(py::module &m) {
                     "colors", &geometry::PointCloud::colors_,
                     "``float64`` array of shape ``(num_points, 3)``, "
                     "range ``[0, 1]`` , use ``numpy.asarray()`` to access "
-                    "data: RGB colors of points.");
+                    "data: RGB colors of points.")
+            .def_readwrite("width", &geometry::PointCloud::width_,
+                           "int: Width of the pixel grid of an organized "
+                           "point cloud, 0 otherwise.")
+            .def_readwrite("height", &geometry::PointCloud::height_,
+                           "int: Height of the pixel grid of an organized "
+                           "point cloud, 0 otherwise.");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_colors");
+    docstring::ClassMethodDocInject(m, "PointCloud", "is_organized");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_normals");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_points");
     docstring::ClassMethodDocInject(m, "PointCloud", "normalize_normals");
@@ -252,6 +289,13 @@ void pybind_pointcloud(py::module &m) {
             m, "PointCloud", "remove_radius_outlier",
             {{"nb_points", "Number of points within the radius."},
              {"radius", "Radius of the sphere."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "remove_radius_outlier_organized",
+            {{"nb_points", "Number of points within the radius."},
+             {"radius", "Radius of the sphere."},
+             {"window_radius",
+              "The window spans 2 * window_radius + 1 pixels on each "
+              "side."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_statistical_outlier",
             {{"nb_neighbors", "Number of neighbors around the target point."},
@@ -264,6 +308,19 @@ void pybind_pointcloud(py::module &m) {
               "If true, the normal estiamtion uses a non-iterative method to "
               "extract the eigenvector from the covariance matrix. This is "
               "faster, but is not as numerical stable."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "estimate_normals_organized",
+            {{"window_radius",
+              "The window spans 2 * window_radius + 1 pixels on each side."},
+             {"max_neighbor_distance",
+              "Neighbors further away from the point, e.g. across a depth "
+              "discontinuity, are ignored."},
+             {"fast_normal_computation",
+              "If true, the normal estiamtion uses a non-iterative method to "
+              "extract the eigenvector from the covariance matrix."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "down_sample_organized",
+            {{"block_size", "Side of the pixel blocks."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "orient_normals_to_align_with_direction",
             {{"orientation_reference",
@@ -304,7 +361,34 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane, 1 runs all "
+              "iterations."},
+             {"num_scoring_points",
+              "If positive, the hypotheses are scored on that many random "
+              "points and the best ones are verified on the whole point "
+              "cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"num_planes", "Maximum number of planes."},
+             {"distance_threshold",
+              "Max distance a point can be from a plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"probability",
+              "Expected probability of finding the optimal plane, 1 runs all "
+              "iterations."},
+             {"num_scoring_points",
+              "If positive, the hypotheses are scored on that many random "
+              "points and the best ones are verified on the whole point "
+              "cloud."},
+             {"min_num_inliers",
+              "The segmentation stops at the first plane with less "
+              "inliers."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
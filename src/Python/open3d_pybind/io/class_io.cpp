@@ -287,6 +287,18 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_pinhole_camera_trajectory",
                                  map_shared_argument_docstrings);
 
+    m_io.def("append_pinhole_camera_parameters",
+             [](const std::string &filename,
+                const camera::PinholeCameraParameters &parameters) {
+                 return io::AppendPinholeCameraParametersToBIN(filename,
+                                                               {parameters});
+             },
+             "Function to append PinholeCameraParameters to a binary "
+             "PinholeCameraTrajectory file (.bin), creating it if needed",
+             "filename"_a, "parameters"_a);
+    docstring::FunctionDocInject(m_io, "append_pinhole_camera_parameters",
+                                 map_shared_argument_docstrings);
+
     // open3d::registration
     m_io.def("read_feature",
              [](const std::string &filename) {
@@ -339,17 +339,24 @@ void pybind_global_optimization(py::module &m) {
                     &registration::GlobalOptimizationOption::reference_node_,
                     "int: The pose of this node is unchanged after "
                     "optimization.")
+            .def_readwrite(
+                    "use_dense_solver",
+                    &registration::GlobalOptimizationOption::use_dense_solver_,
+                    "bool: Solves the normal equations with a dense matrix "
+                    "instead of the sparse block Hessian.")
             .def(py::init([](double max_correspondence_distance,
                              double edge_prune_threshold,
                              double preference_loop_closure,
-                             int reference_node) {
+                             int reference_node, bool use_dense_solver) {
                      return new registration::GlobalOptimizationOption(
                              max_correspondence_distance, edge_prune_threshold,
-                             preference_loop_closure, reference_node);
+                             preference_loop_closure, reference_node,
+                             use_dense_solver);
                  }),
                  "max_correspondence_distance"_a = 0.03,
                  "edge_prune_threshold"_a = 0.25,
-                 "preference_loop_closure"_a = 1.0, "reference_node"_a = -1)
+                 "preference_loop_closure"_a = 1.0, "reference_node"_a = -1,
+                 "use_dense_solver"_a = false)
             .def("__repr__",
                  [](const registration::GlobalOptimizationOption &goo) {
                      return std::string("GlobalOptimizationOption") +
@@ -360,7 +367,76 @@ void pybind_global_optimization(py::module &m) {
                             std::string("\n> preference_loop_closure : ") +
                             std::to_string(goo.preference_loop_closure_) +
                             std::string("\n> reference_node : ") +
-                            std::to_string(goo.reference_node_);
+                            std::to_string(goo.reference_node_) +
+                            std::string("\n> use_dense_solver : ") +
+                            std::to_string(goo.use_dense_solver_);
+                 });
+
+    // open3d.registration.IncrementalPoseGraphOptimizer
+    py::class_<registration::IncrementalPoseGraphOptimizer> incremental(
+            m, "IncrementalPoseGraphOptimizer",
+            "Pose graph optimizer for graphs that grow a few nodes and edges "
+            "at a time. Every update only optimizes the nodes within "
+            "window_size edges of the new nodes and edges, unless they close "
+            "a loop.");
+    py::detail::bind_copy_functions<
+            registration::IncrementalPoseGraphOptimizer>(incremental);
+    incremental
+            .def(py::init<const registration::
+                                  GlobalOptimizationConvergenceCriteria &,
+                          const registration::GlobalOptimizationOption &, int,
+                          double>(),
+                 "criteria"_a =
+                         registration::GlobalOptimizationConvergenceCriteria(),
+                 "option"_a = registration::GlobalOptimizationOption(),
+                 "window_size"_a = 10, "relinearize_threshold"_a = 1e-3)
+            .def("add_node",
+                 &registration::IncrementalPoseGraphOptimizer::AddNode,
+                 "Adds a node and returns its id.", "node"_a)
+            .def("add_edge",
+                 &registration::IncrementalPoseGraphOptimizer::AddEdge,
+                 "Adds an edge between existing nodes and returns its id.",
+                 "edge"_a)
+            .def("update", &registration::IncrementalPoseGraphOptimizer::Update,
+                 "Optimizes the nodes affected by the nodes and edges added "
+                 "since the previous update.")
+            .def("get_pose",
+                 [](const registration::IncrementalPoseGraphOptimizer &opt,
+                    int node_id) {
+                     return Eigen::Matrix4d(opt.GetPose(node_id));
+                 },
+                 "Returns the current pose of a node.", "node_id"_a)
+            .def_property_readonly(
+                    "pose_graph",
+                    &registration::IncrementalPoseGraphOptimizer::GetPoseGraph,
+                    "``PoseGraph``: The current pose graph.")
+            .def_readwrite("criteria",
+                           &registration::IncrementalPoseGraphOptimizer::
+                                   criteria_,
+                           "Convergence criteria of every update.")
+            .def_readwrite(
+                    "option",
+                    &registration::IncrementalPoseGraphOptimizer::option_,
+                    "Line process and reference node options.")
+            .def_readwrite("window_size",
+                           &registration::IncrementalPoseGraphOptimizer::
+                                   window_size_,
+                           "int: Number of edges from the new nodes and edges "
+                           "within which nodes are optimized.")
+            .def_readwrite("relinearize_threshold",
+                           &registration::IncrementalPoseGraphOptimizer::
+                                   relinearize_threshold_,
+                           "float: Motion of a node beyond which the Jacobians "
+                           "of its edges are recomputed.")
+            .def("__repr__",
+                 [](const registration::IncrementalPoseGraphOptimizer &opt) {
+                     return std::string(
+                                    "registration::"
+                                    "IncrementalPoseGraphOptimizer with ") +
+                            std::to_string(opt.GetPoseGraph().nodes_.size()) +
+                            std::string(" nodes and ") +
+                            std::to_string(opt.GetPoseGraph().edges_.size()) +
+                            std::string(" edges.");
                  });
 }
 
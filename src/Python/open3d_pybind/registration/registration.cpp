@@ -30,6 +30,8 @@
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/GeneralizedICP.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Console.h"
 
@@ -64,6 +66,15 @@ public:
     }
 };
 
+template <class RobustKernelBase = registration::RobustKernel>
+class PyRobustKernel : public RobustKernelBase {
+public:
+    using RobustKernelBase::RobustKernelBase;
+    double Weight(double residual) const override {
+        PYBIND11_OVERLOAD_PURE(double, RobustKernelBase, residual);
+    }
+};
+
 template <class CorrespondenceCheckerBase = registration::CorrespondenceChecker>
 class PyCorrespondenceChecker : public CorrespondenceCheckerBase {
 public:
@@ -153,6 +164,75 @@ void pybind_registration_classes(py::module &m) {
                              c.max_iteration_, c.max_validation_);
                  });
 
+    // open3d.registration.RobustKernel
+    py::class_<registration::RobustKernel,
+               std::shared_ptr<registration::RobustKernel>,
+               PyRobustKernel<registration::RobustKernel>>
+            rk(m, "RobustKernel",
+               "Base class of the robust kernels used to down-weight outlier "
+               "residuals.");
+    rk.def("weight", &registration::RobustKernel::Weight, "residual"_a,
+           "Returns the weight of the given residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, std::shared_ptr<registration::L2Loss>,
+               PyRobustKernel<registration::L2Loss>,
+               registration::RobustKernel>
+            l2_loss(m, "L2Loss",
+                    "Plain least squares, all residuals are weighted "
+                    "equally.");
+    l2_loss.def(py::init<>()).def(
+            "__repr__",
+            [](const registration::L2Loss &rk) {
+                return std::string("L2Loss");
+            });
+
+    // open3d.registration.HuberLoss: RobustKernel
+    py::class_<registration::HuberLoss,
+               std::shared_ptr<registration::HuberLoss>,
+               PyRobustKernel<registration::HuberLoss>,
+               registration::RobustKernel>
+            huber_loss(m, "HuberLoss",
+                       "Quadratic for residuals up to k and linear beyond.");
+    huber_loss.def(py::init<double>(), "k"_a)
+            .def("__repr__",
+                 [](const registration::HuberLoss &rk) {
+                     return fmt::format("HuberLoss with k={:e}", rk.k_);
+                 })
+            .def_readwrite("k", &registration::HuberLoss::k_,
+                           "Residual where the loss becomes linear.");
+
+    // open3d.registration.CauchyLoss: RobustKernel
+    py::class_<registration::CauchyLoss,
+               std::shared_ptr<registration::CauchyLoss>,
+               PyRobustKernel<registration::CauchyLoss>,
+               registration::RobustKernel>
+            cauchy_loss(m, "CauchyLoss",
+                        "Logarithmic loss, large residuals keep a weight that "
+                        "decays as 1 / r^2.");
+    cauchy_loss.def(py::init<double>(), "k"_a)
+            .def("__repr__",
+                 [](const registration::CauchyLoss &rk) {
+                     return fmt::format("CauchyLoss with k={:e}", rk.k_);
+                 })
+            .def_readwrite("k", &registration::CauchyLoss::k_,
+                           "Scale of the residuals.");
+
+    // open3d.registration.TukeyLoss: RobustKernel
+    py::class_<registration::TukeyLoss,
+               std::shared_ptr<registration::TukeyLoss>,
+               PyRobustKernel<registration::TukeyLoss>,
+               registration::RobustKernel>
+            tukey_loss(m, "TukeyLoss",
+                       "Tukey's biweight, residuals beyond k are ignored.");
+    tukey_loss.def(py::init<double>(), "k"_a)
+            .def("__repr__",
+                 [](const registration::TukeyLoss &rk) {
+                     return fmt::format("TukeyLoss with k={:e}", rk.k_);
+                 })
+            .def_readwrite("k", &registration::TukeyLoss::k_,
+                           "Residual beyond which the weight is zero.");
+
     // open3d.registration.TransformationEstimation
     py::class_<
             registration::TransformationEstimation,
@@ -236,11 +316,66 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
             registration::TransformationEstimationPointToPlane>(te_p2l);
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPlane>(te_p2l);
-    te_p2l.def(
-            "__repr__",
-            [](const registration::TransformationEstimationPointToPlane &te) {
-                return std::string("TransformationEstimationPointToPlane");
-            });
+    te_p2l.def(py::init([](std::shared_ptr<registration::RobustKernel> kernel) {
+                   return new registration::
+                           TransformationEstimationPointToPlane(
+                                   std::move(kernel));
+               }),
+               "kernel"_a)
+            .def("__repr__",
+                 [](const registration::TransformationEstimationPointToPlane
+                            &te) {
+                     return std::string(
+                             "TransformationEstimationPointToPlane");
+                 })
+            .def_readwrite("kernel",
+                           &registration::TransformationEstimationPointToPlane::
+                                   kernel_,
+                           "Robust kernel that weights the point to plane "
+                           "residuals, the L2 loss if None.");
+
+    // open3d.registration.TransformationEstimationForGeneralizedICP:
+    // TransformationEstimation
+    py::class_<registration::TransformationEstimationForGeneralizedICP,
+               PyTransformationEstimation<
+                       registration::TransformationEstimationForGeneralizedICP>,
+               registration::TransformationEstimation>
+            te_gicp(m, "TransformationEstimationForGeneralizedICP",
+                    "Class to estimate a transformation for plane to plane "
+                    "distance, with point covariances built from the "
+                    "normals.");
+    py::detail::bind_copy_functions<
+            registration::TransformationEstimationForGeneralizedICP>(te_gicp);
+    te_gicp.def(py::init([](double epsilon,
+                            std::shared_ptr<registration::RobustKernel>
+                                    kernel) {
+                    return new registration::
+                            TransformationEstimationForGeneralizedICP(
+                                    epsilon, std::move(kernel));
+                }),
+                "epsilon"_a = 1e-3,
+                "kernel"_a = std::make_shared<registration::L2Loss>())
+            .def("__repr__",
+                 [](const registration::
+                            TransformationEstimationForGeneralizedICP &te) {
+                     return fmt::format(
+                             "TransformationEstimationForGeneralizedICP with "
+                             "epsilon={:e}",
+                             te.epsilon_);
+                 })
+            .def_readwrite("epsilon",
+                           &registration::
+                                   TransformationEstimationForGeneralizedICP::
+                                           epsilon_,
+                           "Variance of the points along their normal, "
+                           "relative to the variance within the surface.")
+            .def_readwrite("kernel",
+                           &registration::
+                                   TransformationEstimationForGeneralizedICP::
+                                           kernel_,
+                           "Robust kernel that weights the Mahalanobis "
+                           "distances of the correspondences, the L2 loss if "
+                           "None.");
 
     // open3d.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
@@ -447,6 +582,29 @@ must hold true for all edges.)");
                              c.maximum_tuple_count_);
                  });
 
+    // open3d.registration.PointCloudPyramid
+    py::class_<registration::PointCloudPyramid> pyramid(
+            m, "PointCloudPyramid",
+            "Voxel downsampled levels of a point cloud, each with its "
+            "KD-tree. Build it once for a target that is registered many "
+            "times with registration_multi_scale_icp.");
+    pyramid.def(py::init<const geometry::PointCloud &,
+                         const std::vector<double> &, bool>(),
+                "cloud"_a, "voxel_sizes"_a, "estimate_normals"_a = false)
+            .def("num_levels", &registration::PointCloudPyramid::NumLevels,
+                 "Returns the number of levels.")
+            .def("get_voxel_sizes",
+                 &registration::PointCloudPyramid::GetVoxelSizes,
+                 "Returns the voxel size of every level.")
+            .def("get_level", &registration::PointCloudPyramid::GetLevel,
+                 "Returns the point cloud of a level.", "level"_a,
+                 py::return_value_policy::reference_internal)
+            .def("__repr__", [](const registration::PointCloudPyramid &p) {
+                return fmt::format(
+                        "registration::PointCloudPyramid with {:d} levels.",
+                        p.NumLevels());
+            });
+
     // open3d.registration.RegistrationResult
     py::class_<registration::RegistrationResult> registration_result(
             m, "RegistrationResult",
@@ -497,10 +655,15 @@ static const std::unordered_map<std::string, std::string>
                  "``registration::CorrespondenceCheckerBasedOnDistance``, "
                  "``registration::CorrespondenceCheckerBasedOnNormal``)"},
                 {"criteria", "Convergence criteria"},
+                {"max_correspondence_distances",
+                 "Maximum correspondence points-pair distance of every "
+                 "level."},
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``registration::TransformationEstimationPointToPoint``, "
-                 "``registration::TransformationEstimationPointToPlane``)"},
+                 "``registration::TransformationEstimationPointToPlane``, "
+                 "``registration::"
+                 "TransformationEstimationForGeneralizedICP``)"},
                 {"init", "Initial transformation estimation"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
@@ -511,6 +674,7 @@ static const std::unordered_map<std::string, std::string>
                 {"source", "The source point cloud."},
                 {"target_feature", "Target point cloud feature."},
                 {"target", "The target point cloud."},
+                {"target_pyramid", "The pyramid of the target point cloud."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
                  "``target``"}};
@@ -533,6 +697,24 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("registration_multi_scale_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &,
+                  const registration::PointCloudPyramid &,
+                  const std::vector<double> &, const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &,
+                  const std::vector<registration::ICPConvergenceCriteria> &)) &
+                  registration::RegistrationMultiScaleICP,
+          "Function for coarse-to-fine ICP registration against a target "
+          "pyramid",
+          "source"_a, "target_pyramid"_a, "max_correspondence_distances"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          "criteria"_a = std::vector<registration::ICPConvergenceCriteria>());
+    docstring::FunctionDocInject(m, "registration_multi_scale_icp",
+                                 map_shared_argument_docstrings);
+
     m.def("registration_colored_icp", &registration::RegistrationColoredICP,
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
@@ -542,6 +724,17 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("registration_generalized_icp",
+          &registration::RegistrationGeneralizedICP,
+          "Function for Generalized ICP registration", "source"_a, "target"_a,
+          "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationForGeneralizedICP(),
+          "criteria"_a = registration::ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "registration_generalized_icp",
+                                 map_shared_argument_docstrings);
+
     m.def("registration_ransac_based_on_correspondence",
           &registration::RegistrationRANSACBasedOnCorrespondence,
           "Function for global RANSAC registration based on a set of "
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+TEST(FusedEW, Chain) {
+    Device device("CPU:0");
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({10, 11, 12, 13, 14, 15}), {2, 3},
+             Dtype::Float32, device);
+    Tensor c(std::vector<float>({1, 4, 9, 16, 25, 36}), {2, 3},
+             Dtype::Float32, device);
+
+    // (a + b) * sqrt(c) - a
+    kernel::FusedEW fused;
+    int64_t a_id = fused.Input(a);
+    int64_t sum = fused.Binary(kernel::BinaryEWOpCode::Add, a_id,
+                               fused.Input(b));
+    int64_t sqrt = fused.Unary(kernel::UnaryEWOpCode::Sqrt, fused.Input(c));
+    int64_t mul = fused.Binary(kernel::BinaryEWOpCode::Mul, sum, sqrt);
+    int64_t result = fused.Binary(kernel::BinaryEWOpCode::Sub, mul, a_id);
+
+    Tensor dst = fused.Run(result);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              ((a + b) * c.Sqrt() - a).ToFlatVector<float>());
+
+    // Intermediate values can be evaluated as well.
+    EXPECT_EQ(fused.Run(sum).ToFlatVector<float>(),
+              (a + b).ToFlatVector<float>());
+    EXPECT_EQ(fused.Run(a_id).ToFlatVector<float>(), a.ToFlatVector<float>());
+}
+
+TEST(FusedEW, BroadcastNonContiguous) {
+    Device device("CPU:0");
+    Tensor a(std::vector<int64_t>({0, 1, 2, 3, 4, 5}), {3, 2}, Dtype::Int64,
+             device);
+    Tensor b(std::vector<int64_t>({10, 20, 30}), {3}, Dtype::Int64, device);
+    Tensor s = Tensor::Full({}, 2, Dtype::Int64, device);
+
+    // (a.T() + b) * 2
+    kernel::FusedEW fused;
+    int64_t result = fused.Binary(
+            kernel::BinaryEWOpCode::Mul,
+            fused.Binary(kernel::BinaryEWOpCode::Add, fused.Input(a.T()),
+                         fused.Input(b)),
+            fused.Input(s));
+    Tensor dst = fused.Run(result);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({20, 44, 68, 22, 46, 70}));
+
+    // Output spanning multiple tiles.
+    Tensor large = Tensor::Ones({5000, 3}, Dtype::Int64, device);
+    kernel::FusedEW fused_large;
+    int64_t result_large = fused_large.Binary(kernel::BinaryEWOpCode::Add,
+                                              fused_large.Input(large),
+                                              fused_large.Input(b));
+    Tensor dst_large = Tensor::Zeros({5000, 3}, Dtype::Int64, device);
+    fused_large.Run(result_large, dst_large);
+    EXPECT_EQ(dst_large.ToFlatVector<int64_t>(),
+              (large + b).ToFlatVector<int64_t>());
+
+    // Output into a non-contiguous Tensor.
+    Tensor dst_t = Tensor::Zeros({3, 2}, Dtype::Int64, device).T();
+    fused.Run(result, dst_t);
+    EXPECT_EQ(dst_t.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({20, 44, 68, 22, 46, 70}));
+}
+
+TEST(FusedEW, Exceptions) {
+    Device device("CPU:0");
+    Tensor a = Tensor::Ones({2, 3}, Dtype::Float32, device);
+    Tensor b = Tensor::Ones({2, 3}, Dtype::Int32, device);
+    Tensor c = Tensor::Ones({3, 2}, Dtype::Float32, device);
+
+    kernel::FusedEW fused;
+    int64_t a_id = fused.Input(a);
+    EXPECT_THROW(fused.Input(b), std::runtime_error);
+    EXPECT_THROW(fused.Binary(kernel::BinaryEWOpCode::LogicalAnd, a_id, a_id),
+                 std::runtime_error);
+    EXPECT_THROW(fused.Unary(kernel::UnaryEWOpCode::LogicalNot, a_id),
+                 std::runtime_error);
+    EXPECT_THROW(fused.Unary(kernel::UnaryEWOpCode::Neg, 5),
+                 std::runtime_error);
+
+    int64_t result = fused.Unary(kernel::UnaryEWOpCode::Neg, a_id);
+    Tensor dst = Tensor::Ones({3, 2}, Dtype::Float32, device);
+    EXPECT_THROW(fused.Run(result, dst), std::runtime_error);
+    fused.Input(c);
+    EXPECT_THROW(fused.Run(result), std::runtime_error);
+}
@@ -183,3 +183,34 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(4), output_base_ptr + 4 * dtype_byte_size);
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
+
+TEST_P(IndexerPermuteDevices, IsContiguous) {
+    Device device = GetParam();
+
+    Tensor input0({2, 3}, Dtype::Float32, device);
+    Tensor input1({}, Dtype::Float32, device);
+    Tensor input2({3}, Dtype::Float32, device);
+    Tensor output({2, 3}, Dtype::Float32, device);
+
+    Indexer indexer({input0, input1, input2}, output);
+    EXPECT_TRUE(indexer.IsOutputContiguous());
+    EXPECT_TRUE(indexer.IsInputContiguous(0));
+    EXPECT_FALSE(indexer.IsInputBroadcastScalar(0));
+    EXPECT_FALSE(indexer.IsInputContiguous(1));
+    EXPECT_TRUE(indexer.IsInputBroadcastScalar(1));
+    EXPECT_FALSE(indexer.IsInputContiguous(2));
+    EXPECT_FALSE(indexer.IsInputBroadcastScalar(2));
+
+    Tensor input_t({3, 2}, Dtype::Float32, device);
+    Indexer indexer_t({input_t.T()}, output);
+    EXPECT_FALSE(indexer_t.IsInputContiguous(0));
+
+    // Size-1 dimensions do not affect contiguity.
+    Tensor input_sliced({2, 3, 3}, Dtype::Float32, device);
+    Tensor output_sliced({2, 3, 1}, Dtype::Float32, device);
+    Indexer indexer_sliced({input_sliced.Slice(2, 0, 1)}, output_sliced);
+    EXPECT_FALSE(indexer_sliced.IsInputContiguous(0));
+    Indexer indexer_ones({Tensor({1, 1, 6}, Dtype::Float32, device)},
+                         Tensor({1, 1, 6}, Dtype::Float32, device));
+    EXPECT_TRUE(indexer_ones.IsInputContiguous(0));
+}
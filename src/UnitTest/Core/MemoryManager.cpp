@@ -31,6 +31,7 @@
 #include "Core/CoreTest.h"
 #include "TestUtility/UnitTest.h"
 
+#include <thread>
 #include <vector>
 
 using namespace std;
@@ -54,6 +55,92 @@ TEST_P(MemoryManagerPermuteDevices, MallocFree) {
     MemoryManager::Free(ptr, device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, MallocAligned) {
+    Device device = GetParam();
+
+    for (size_t byte_size : {1, 10, 64, 100, 1000, 1 << 20}) {
+        void* ptr = MemoryManager::Malloc(byte_size, device);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        MemoryManager::Free(ptr, device);
+    }
+}
+
+TEST(MemoryManager, CPUCache) {
+    Device device("CPU:0");
+    MemoryManager::ReleaseCache(device);
+    MemoryCacheStatistics stats = MemoryManager::GetCacheStatistics(device);
+
+    // A freed block is reused for a request of the same bucket size.
+    void* ptr = MemoryManager::Malloc(1000, device);
+    MemoryManager::Free(ptr, device);
+    void* ptr_reused = MemoryManager::Malloc(990, device);
+    EXPECT_EQ(ptr, ptr_reused);
+    MemoryManager::Free(ptr_reused, device);
+
+    MemoryCacheStatistics new_stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(new_stats.num_misses_, stats.num_misses_ + 1);
+    EXPECT_EQ(new_stats.num_hits_, stats.num_hits_ + 1);
+    EXPECT_GE(new_stats.cached_bytes_, stats.cached_bytes_ + 990);
+
+    // Released blocks are not counted as cached.
+    MemoryManager::ReleaseCache(device);
+    new_stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(new_stats.cached_bytes_, stats.cached_bytes_);
+
+    // Lowering the limit frees cached blocks, from the thread-local and the
+    // global caches, down to the new limit.
+    std::vector<void*> ptrs;
+    for (size_t byte_size : {1000, 2000, 4000, 1 << 21, 1 << 22}) {
+        ptrs.push_back(MemoryManager::Malloc(byte_size, device));
+    }
+    for (void* p : ptrs) {
+        MemoryManager::Free(p, device);
+    }
+    new_stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_GE(new_stats.cached_bytes_,
+              stats.cached_bytes_ + (1 << 21) + (1 << 22) + 7000);
+    int64_t cache_limit = stats.cached_bytes_ + (1 << 22);
+    MemoryManager::SetCacheLimit(device, cache_limit);
+    new_stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_LE(new_stats.cached_bytes_, cache_limit);
+    MemoryManager::SetCacheLimit(device, 0);
+    new_stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(new_stats.cached_bytes_, stats.cached_bytes_);
+
+    // With a zero cache limit, blocks are given back to the system.
+    ptr = MemoryManager::Malloc(1000, device);
+    MemoryManager::Free(ptr, device);
+    new_stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(new_stats.cached_bytes_, stats.cached_bytes_);
+    MemoryManager::SetCacheLimit(device, 1LL << 30);
+}
+
+namespace {
+
+/// Frees a block when the thread exits, after its memory cache if that was
+/// created later.
+struct FreeAtThreadExit {
+    ~FreeAtThreadExit() { MemoryManager::Free(ptr_, Device("CPU:0")); }
+    void* ptr_ = nullptr;
+};
+
+}  // namespace
+
+TEST(MemoryManager, CPUFreeAfterThreadCache) {
+    Device device("CPU:0");
+    MemoryManager::ReleaseCache(device);
+
+    // The block outlives the thread's cache, so it goes to the global cache.
+    void* ptr = nullptr;
+    std::thread([&]() {
+        static thread_local FreeAtThreadExit free_at_exit;
+        free_at_exit.ptr_ = ptr = MemoryManager::Malloc(1000, device);
+    }).join();
+    void* ptr_reused = MemoryManager::Malloc(1000, device);
+    EXPECT_EQ(ptr, ptr_reused);
+    MemoryManager::Free(ptr_reused, device);
+}
+
 TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     Device dst_device;
     Device src_device;
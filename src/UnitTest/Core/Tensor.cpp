@@ -1060,6 +1060,34 @@ TEST_P(TensorPermuteDevices, Add_BroadcastException) {
                                   20, 22, 24, 26, 28, 30, 32, 34}));
 }
 
+TEST_P(TensorPermuteDevices, BinaryEWNonContiguous) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({10, 11, 12, 13, 14, 15}), {3, 2},
+             Dtype::Float32, device);
+
+    // Contiguous lhs, strided rhs.
+    Tensor c = a + b.T();
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({10, 13, 16, 14, 17, 20}));
+
+    // Strided lhs, broadcasted scalar rhs.
+    c = b.T() * 2;
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({20, 24, 28, 22, 26, 30}));
+
+    // Broadcasted scalar lhs, contiguous rhs.
+    c = 20 - a;
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({20, 19, 18, 17, 16, 15}));
+
+    // Strided unary op.
+    c = b.T().Neg();
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({-10, -12, -14, -11, -13, -15}));
+}
+
 TEST_P(TensorPermuteDevices, Sub) {
     Device device = GetParam();
     Tensor a(std::vector<float>({10, 12, 14, 16, 18, 20}), {2, 3},
@@ -1394,6 +1422,40 @@ TEST_P(TensorPermuteDevices, ReduceSumLargeArray) {
     }
 }
 
+TEST_P(TensorPermuteDevices, ReduceSumMultiOutput) {
+    Device device = GetParam();
+
+    // Few outputs with a long reduction dim, e.g. column sums of points.
+    for (int64_t num_cols : {3, 33}) {
+        int64_t num_rows = 100000;
+        std::vector<int> vals(num_rows * num_cols);
+        std::transform(
+                vals.begin(), vals.end(), vals.begin(),
+                [](int x) -> int { return utility::UniformRandInt(0, 3); });
+        std::vector<int> col_sums(num_cols, 0);
+        std::vector<int> row_sums(num_rows, 0);
+        for (int64_t r = 0; r < num_rows; ++r) {
+            for (int64_t c = 0; c < num_cols; ++c) {
+                col_sums[c] += vals[r * num_cols + c];
+                row_sums[r] += vals[r * num_cols + c];
+            }
+        }
+
+        Tensor src(vals, {num_rows, num_cols}, Dtype::Int32, device);
+        Tensor dst = src.Sum({0});
+        EXPECT_EQ(dst.GetShape(), SizeVector({num_cols}));
+        EXPECT_EQ(dst.ToFlatVector<int>(), col_sums);
+
+        dst = src.T().Sum({1}, true);
+        EXPECT_EQ(dst.GetShape(), SizeVector({num_cols, 1}));
+        EXPECT_EQ(dst.ToFlatVector<int>(), col_sums);
+
+        dst = src.Sum({1});
+        EXPECT_EQ(dst.GetShape(), SizeVector({num_rows}));
+        EXPECT_EQ(dst.ToFlatVector<int>(), row_sums);
+    }
+}
+
 TEST_P(TensorPermuteDevices, ReduceProd) {
     Device device = GetParam();
     Tensor src(
@@ -1609,6 +1671,58 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST(Tensor, Matmul) {
+    Device device("CPU:0");
+    Tensor lhs(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+               device);
+    Tensor rhs(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}),
+               {3, 4}, Dtype::Float32, device);
+    Tensor dst = lhs.Matmul(rhs);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 4}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({20, 23, 26, 29, 56, 68, 80, 92}));
+
+    // Non-contiguous operands.
+    dst = rhs.T().Matmul(lhs.T());
+    EXPECT_EQ(dst.GetShape(), SizeVector({4, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({20, 56, 23, 68, 26, 80, 29, 92}));
+
+    Tensor lhs_int(std::vector<int32_t>({1, 2, 3, 4}), {2, 2}, Dtype::Int32,
+                   device);
+    dst = lhs_int.Matmul(lhs_int);
+    EXPECT_EQ(dst.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({7, 10, 15, 22}));
+
+    // (N, 3) x (3, 3) takes the small-matrix path.
+    Tensor points(std::vector<double>({1, 2, 3, 4, 5, 6}), {2, 3},
+                  Dtype::Float64, device);
+    Tensor rotation(std::vector<double>({0, 1, 0, -1, 0, 0, 0, 0, 1}), {3, 3},
+                    Dtype::Float64, device);
+    dst = points.Matmul(rotation);
+    EXPECT_EQ(dst.ToFlatVector<double>(),
+              std::vector<double>({-2, 1, 3, -5, 4, 6}));
+
+    EXPECT_THROW(lhs.Matmul(lhs), std::runtime_error);
+    EXPECT_THROW(lhs.Matmul(rhs.Reshape({12})), std::runtime_error);
+    EXPECT_THROW(lhs.Matmul(rhs.To(Dtype::Float64)), std::runtime_error);
+}
+
+TEST(Tensor, BatchMatmul) {
+    Device device("CPU:0");
+    Tensor lhs(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7}), {2, 2, 2},
+               Dtype::Float32, device);
+    Tensor rhs(std::vector<float>({1, 0, 0, 1, 0, 1, 1, 0}), {2, 2, 2},
+               Dtype::Float32, device);
+    Tensor dst = lhs.BatchMatmul(rhs);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 2, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 5, 4, 7, 6}));
+
+    EXPECT_THROW(lhs.BatchMatmul(rhs.Slice(0, 0, 1)), std::runtime_error);
+    EXPECT_THROW(lhs.BatchMatmul(rhs.Reshape({4, 2})), std::runtime_error);
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     Device device = GetParam();
     Tensor src(std::vector<float>({0, 1, 4, 9, 16, 25}), {2, 3}, Dtype::Float32,
@@ -144,3 +144,279 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_indices, indices);
     ExpectEQ(ref_distance2, distance2);
 }
+
+TEST(KDTreeFlann, SearchKNNBatch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> queries(20);
+    Rand(queries, vmin, vmax, 1);
+    Map<const MatrixXd> queries_map((const double *)queries.data(), 3,
+                                    queries.size());
+    int knn = 30;
+    vector<int> indices;
+    vector<double> distance2;
+
+    int result = kdtree.SearchKNNBatch(queries_map, knn, indices, distance2);
+
+    EXPECT_EQ(result, 20 * knn);
+    EXPECT_EQ(indices.size(), 20u * knn);
+    EXPECT_EQ(distance2.size(), 20u * knn);
+    for (size_t i = 0; i < queries.size(); i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        kdtree.SearchKNN(queries[i], knn, ref_indices, ref_distance2);
+        ExpectEQ(ref_indices, vector<int>(indices.begin() + i * knn,
+                                          indices.begin() + (i + 1) * knn));
+        ExpectEQ(ref_distance2,
+                 vector<double>(distance2.begin() + i * knn,
+                                distance2.begin() + (i + 1) * knn));
+    }
+
+    // Unused entries are padded when knn exceeds the number of points.
+    result = kdtree.SearchKNNBatch(queries_map, size + 2, indices, distance2);
+
+    EXPECT_EQ(result, 20 * size);
+    EXPECT_EQ(indices[size], -1);
+    EXPECT_EQ(indices[size + 1], -1);
+    EXPECT_TRUE(std::isinf(distance2[size + 1]));
+    EXPECT_EQ(indices[2 * (size + 2) - 1], -1);
+}
+
+TEST(KDTreeFlann, SearchRadiusBatch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> queries(20);
+    Rand(queries, vmin, vmax, 1);
+    double radius = 3.0;
+    vector<int> indices;
+    vector<double> distance2;
+    vector<size_t> offsets;
+
+    int result = kdtree.SearchRadiusBatch(
+            Map<const MatrixXd>((const double *)queries.data(), 3,
+                                queries.size()),
+            radius, indices, distance2, offsets);
+
+    EXPECT_EQ(offsets.size(), queries.size() + 1);
+    EXPECT_EQ(offsets[0], 0u);
+    EXPECT_EQ(size_t(result), offsets.back());
+    EXPECT_EQ(indices.size(), offsets.back());
+    EXPECT_EQ(distance2.size(), offsets.back());
+    for (size_t i = 0; i < queries.size(); i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        kdtree.SearchRadius(queries[i], radius, ref_indices, ref_distance2);
+        ExpectEQ(ref_indices, vector<int>(indices.begin() + offsets[i],
+                                          indices.begin() + offsets[i + 1]));
+        ExpectEQ(ref_distance2,
+                 vector<double>(distance2.begin() + offsets[i],
+                                distance2.begin() + offsets[i + 1]));
+    }
+}
+
+TEST(KDTreeFlann, SearchHybridBatch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> queries(20);
+    Rand(queries, vmin, vmax, 1);
+    int max_nn = 15;
+    double radius = 3.0;
+    vector<int> indices;
+    vector<double> distance2;
+    vector<int> counts;
+
+    int result = kdtree.SearchHybridBatch(
+            Map<const MatrixXd>((const double *)queries.data(), 3,
+                                queries.size()),
+            radius, max_nn, indices, distance2, counts);
+
+    EXPECT_EQ(counts.size(), queries.size());
+    int total = 0;
+    for (size_t i = 0; i < queries.size(); i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        int k = kdtree.SearchHybrid(queries[i], radius, max_nn, ref_indices,
+                                    ref_distance2);
+        EXPECT_EQ(k, counts[i]);
+        ExpectEQ(ref_indices,
+                 vector<int>(indices.begin() + i * max_nn,
+                             indices.begin() + i * max_nn + counts[i]));
+        ExpectEQ(ref_distance2,
+                 vector<double>(distance2.begin() + i * max_nn,
+                                distance2.begin() + i * max_nn + counts[i]));
+        for (int j = counts[i]; j < max_nn; j++) {
+            EXPECT_EQ(indices[i * max_nn + j], -1);
+        }
+        total += counts[i];
+    }
+    EXPECT_EQ(result, total);
+}
+
+TEST(KDTreeFlann, SetGeometryInPlace) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+    geometry::KDTreeFlann kdtree_in_place;
+    EXPECT_TRUE(kdtree_in_place.SetGeometryInPlace(pc));
+
+    vector<Vector3d> queries(10);
+    Rand(queries, vmin, vmax, 1);
+    for (const auto &query : queries) {
+        vector<int> ref_indices, indices;
+        vector<double> ref_distance2, distance2;
+
+        kdtree.SearchKNN(query, 10, ref_indices, ref_distance2);
+        EXPECT_EQ(10, kdtree_in_place.SearchKNN(query, 10, indices,
+                                                distance2));
+        ExpectEQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2);
+
+        kdtree.SearchRadius(query, 3.0, ref_indices, ref_distance2);
+        kdtree_in_place.SearchRadius(query, 3.0, indices, distance2);
+        ExpectEQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2);
+    }
+
+    // A matrix is indexed in place as well.
+    MatrixXd data = Map<const MatrixXd>((const double *)pc.points_.data(), 3,
+                                        pc.points_.size());
+    EXPECT_TRUE(kdtree_in_place.SetMatrixDataInPlace(data));
+    vector<int> ref_indices, indices;
+    vector<double> ref_distance2, distance2;
+    kdtree.SearchHybrid(queries[0], 3.0, 5, ref_indices, ref_distance2);
+    kdtree_in_place.SearchHybrid(queries[0], 3.0, 5, indices, distance2);
+    ExpectEQ(ref_indices, indices);
+    ExpectEQ(ref_distance2, distance2);
+
+    geometry::PointCloud empty;
+    EXPECT_FALSE(kdtree_in_place.SetGeometryInPlace(empty));
+    EXPECT_EQ(-1, kdtree_in_place.SearchKNN(queries[0], 1, indices,
+                                            distance2));
+}
+
+TEST(KDTreeFlann, SearchKNNIntoBuffer) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> queries(10);
+    Rand(queries, vmin, vmax, 1);
+
+    // The same buffers are reused for every query.
+    int knn = 8;
+    vector<int> indices(knn);
+    vector<double> distance2(knn);
+    for (const auto &query : queries) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+
+        kdtree.SearchKNN(query, knn, ref_indices, ref_distance2);
+        EXPECT_EQ(knn, kdtree.SearchKNN(query, knn, indices.data(),
+                                        distance2.data()));
+        ExpectEQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2);
+
+        int k = kdtree.SearchHybrid(query, 2.0, knn, ref_indices,
+                                    ref_distance2);
+        EXPECT_EQ(k, kdtree.SearchHybrid(query, 2.0, knn, indices.data(),
+                                         distance2.data()));
+        ExpectEQ(ref_indices, vector<int>(indices.begin(),
+                                          indices.begin() + k));
+        ExpectEQ(ref_distance2, vector<double>(distance2.begin(),
+                                               distance2.begin() + k));
+    }
+
+    // At most all points are found.
+    vector<int> all_indices(size + 1);
+    vector<double> all_distance2(size + 1);
+    EXPECT_EQ(size, kdtree.SearchKNN(queries[0], size + 1, all_indices.data(),
+                                     all_distance2.data()));
+}
+
+TEST(KDTreeFlann, CountRadius) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> queries(20);
+    Rand(queries, vmin, vmax, 1);
+    double radius = 3.0;
+    for (const auto &query : queries) {
+        vector<int> indices;
+        vector<double> distance2;
+        int k = kdtree.SearchRadius(query, radius, indices, distance2);
+        EXPECT_EQ(k, kdtree.CountRadius(query, radius));
+        EXPECT_EQ(k, kdtree.CountRadius(Vector3f(query.cast<float>()),
+                                        radius));
+
+        // The count stops at max_count.
+        EXPECT_EQ(std::min(k, 3), kdtree.CountRadius(query, radius, 3));
+        EXPECT_EQ(k, kdtree.CountRadius(query, radius, k + 1));
+
+        // The points counted are neighbors.
+        vector<int> counted(k + 1);
+        EXPECT_EQ(k, kdtree.CountRadius(query, radius, k + 1, counted.data()));
+        counted.resize(k);
+        sort(counted.begin(), counted.end());
+        sort(indices.begin(), indices.end());
+        ExpectEQ(indices, counted);
+    }
+
+    EXPECT_EQ(-1, kdtree.CountRadius(queries[0], radius, -1));
+    int index;
+    EXPECT_EQ(-1, kdtree.CountRadius(queries[0], radius, 0, &index));
+}
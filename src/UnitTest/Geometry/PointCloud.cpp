@@ -25,8 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <limits>
+#include <map>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Core/Tensor.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -394,6 +397,44 @@ TEST(PointCloud, OperatorADD) {
     }
 }
 
+TEST(PointCloud, GetPointsTensorView) {
+    geometry::PointCloud pc;
+    pc.points_ = {{0, 1, 2}, {3, 4, 5}};
+    pc.normals_ = {{0, 0, 1}, {0, 1, 0}};
+
+    Tensor points = pc.GetPointsTensorView();
+    EXPECT_EQ(points.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(points.GetDtype(), Dtype::Float64);
+    EXPECT_EQ(points.GetDataPtr(), pc.points_.data());
+    EXPECT_EQ(points.ToFlatVector<double>(),
+              vector<double>({0, 1, 2, 3, 4, 5}));
+
+    // Writes through the view modify the point cloud.
+    points.Mul_(2);
+    ExpectEQ(pc.points_, vector<Vector3d>({{0, 2, 4}, {6, 8, 10}}));
+
+    Tensor normals = pc.GetNormalsTensorView();
+    EXPECT_EQ(normals.GetDataPtr(), pc.normals_.data());
+    EXPECT_EQ(normals.Sum({0}).ToFlatVector<double>(),
+              vector<double>({0, 1, 1}));
+
+    EXPECT_EQ(pc.GetColorsTensorView().GetShape(), SizeVector({0, 3}));
+}
+
+TEST(PointCloud, CreateFromTensor) {
+    Tensor points(vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32);
+
+    auto pc = geometry::PointCloud::CreateFromTensor(points);
+    ExpectEQ(pc->points_, vector<Vector3d>({{0, 1, 2}, {3, 4, 5}}));
+
+    // Non-contiguous input.
+    pc = geometry::PointCloud::CreateFromTensor(points.T().Contiguous().T());
+    ExpectEQ(pc->points_, vector<Vector3d>({{0, 1, 2}, {3, 4, 5}}));
+
+    EXPECT_THROW(geometry::PointCloud::CreateFromTensor(points.T()),
+                 std::runtime_error);
+}
+
 TEST(PointCloud, DISABLED_CreatePointCloudFromFile) {
     unit_test::NotImplemented();
 }
@@ -527,6 +568,76 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ref_colors, output_pc->colors_);
 }
 
+TEST(PointCloud, VoxelDownSampleDeterministic) {
+    geometry::PointCloud pc;
+    pc.points_.resize(5000);
+    pc.colors_.resize(5000);
+    Rand(pc.points_, Vector3d(-10.0, -10.0, -10.0), Vector3d(10.0, 10.0, 10.0),
+         0);
+    Rand(pc.colors_, Zero3d, Vector3d(1.0, 1.0, 1.0), 1);
+
+    // Serial reference, voxels in lexicographic order of their coordinates
+    // and points in their original order within a voxel.
+    double voxel_size = 1.5;
+    Vector3d voxel_min_bound =
+            pc.GetMinBound() - Vector3d::Constant(voxel_size * 0.5);
+    map<vector<int>, vector<size_t>> voxels;
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        Vector3d ref_coord = (pc.points_[i] - voxel_min_bound) / voxel_size;
+        voxels[{int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                int(floor(ref_coord(2)))}]
+                .push_back(i);
+    }
+    vector<Vector3d> ref_points;
+    vector<Vector3d> ref_colors;
+    for (const auto &voxel : voxels) {
+        Vector3d point = Zero3d;
+        Vector3d color = Zero3d;
+        for (size_t i : voxel.second) {
+            point += pc.points_[i];
+            color += pc.colors_[i];
+        }
+        ref_points.push_back(point / double(voxel.second.size()));
+        ref_colors.push_back(color / double(voxel.second.size()));
+    }
+
+    auto output_pc = pc.VoxelDownSample(voxel_size);
+    ASSERT_EQ(ref_points.size(), output_pc->points_.size());
+    ExpectEQ(ref_points, output_pc->points_, 0.0);
+    ExpectEQ(ref_colors, output_pc->colors_, 0.0);
+}
+
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pc({{0.2, 0.2, 0.2},
+                             {1.2, 0.2, 0.2},
+                             {0.8, 0.2, 0.2},
+                             {1.4, 0.2, 0.7},
+                             {0.6, 0.9, 0.4}});
+    pc.colors_ = {{1.0, 1.0, 1.0},
+                  {2.0, 2.0, 2.0},
+                  {2.0, 2.0, 2.0},
+                  {2.0, 2.0, 2.0},
+                  {3.0, 3.0, 3.0}};
+
+    Eigen::MatrixXi cubic_id;
+    vector<vector<int>> original_indices;
+    std::shared_ptr<geometry::PointCloud> output_ptr;
+    std::tie(output_ptr, cubic_id, original_indices) =
+            pc.VoxelDownSampleAndTrace(1.0, Zero3d, Vector3d(2.0, 2.0, 2.0),
+                                       true);
+
+    ExpectEQ(vector<Vector3d>({{0.533333, 0.433333, 0.266667},
+                               {1.3, 0.2, 0.45}}),
+             output_ptr->points_);
+    // Classes 1, 2 and 3 tie in the first voxel, the smallest one is taken.
+    ExpectEQ(vector<Vector3d>({{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}}),
+             output_ptr->colors_);
+    EXPECT_EQ(vector<vector<int>>({{0, 2, 4}, {1, 3}}), original_indices);
+    Eigen::MatrixXi ref_cubic_id(2, 8);
+    ref_cubic_id << 0, 2, -1, 4, -1, -1, -1, -1, 1, -1, -1, -1, 3, -1, -1, -1;
+    EXPECT_EQ(ref_cubic_id, cubic_id);
+}
+
 TEST(PointCloud, UniformDownSample) {
     vector<Vector3d> ref = {{839.215686, 392.156863, 780.392157},
                             {364.705882, 509.803922, 949.019608},
@@ -1057,13 +1168,103 @@ TEST(PointCloud, CreatePointCloudFromRGBDImage_1_4) {
                                        ref_colors);
 }
 
+TEST(PointCloud, ClusterDBSCAN) {
+    // Two clusters of points 0.1 apart along a line, and an isolated point.
+    geometry::PointCloud pc;
+    for (int i = 0; i < 10; i++) {
+        pc.points_.push_back(Vector3d(0.1 * i, 0.0, 0.0));
+    }
+    pc.points_.push_back(Vector3d(10.0, 10.0, 10.0));
+    for (int i = 0; i < 10; i++) {
+        pc.points_.push_back(Vector3d(5.0 + 0.1 * i, 0.0, 0.0));
+    }
+
+    vector<int> labels = pc.ClusterDBSCAN(0.15, 3);
+
+    vector<int> ref(21, 0);
+    ref[10] = -1;
+    fill(ref.begin() + 11, ref.end(), 1);
+    ExpectEQ(ref, labels);
+}
+
+namespace {
+
+/// DBSCAN by expanding one cluster after the other in point order, with brute
+/// force neighbor searches.
+vector<int> ClusterDBSCANSerial(const vector<Vector3d> &points,
+                                double eps,
+                                size_t min_points) {
+    int n = int(points.size());
+    vector<vector<int>> nbs(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if ((points[i] - points[j]).squaredNorm() < eps * eps) {
+                nbs[i].push_back(j);
+            }
+        }
+    }
+    vector<int> labels(n, -2);
+    int cluster_label = 0;
+    for (int i = 0; i < n; i++) {
+        if (labels[i] != -2) continue;
+        if (nbs[i].size() < min_points) {
+            labels[i] = -1;
+            continue;
+        }
+        vector<int> frontier = {i};
+        labels[i] = cluster_label;
+        while (!frontier.empty()) {
+            int p = frontier.back();
+            frontier.pop_back();
+            if (nbs[p].size() < min_points) continue;
+            for (int q : nbs[p]) {
+                if (labels[q] == -2) frontier.push_back(q);
+                if (labels[q] < 0) labels[q] = cluster_label;
+            }
+        }
+        cluster_label++;
+    }
+    return labels;
+}
+
+}  // unnamed namespace
+
+TEST(PointCloud, ClusterDBSCANMatchesSerial) {
+    vector<Vector3d> centers(8);
+    Rand(centers, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    vector<Vector3d> offsets(1000);
+    Rand(offsets, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 1);
+    vector<Vector3d> noise(200);
+    Rand(noise, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 2);
+
+    // Blobs of points with sparse noise, so that clusters touch through
+    // border points. The wide blobs are clustered with a KDTree, the tight
+    // ones on a grid.
+    for (double blob_size : {1.0, 0.2}) {
+        geometry::PointCloud pc;
+        for (size_t i = 0; i < offsets.size(); i++) {
+            pc.points_.push_back(centers[i % centers.size()] +
+                                 offsets[i] * blob_size);
+        }
+        pc.points_.insert(pc.points_.end(), noise.begin(), noise.end());
+
+        for (double eps : {0.3 * blob_size, 0.5 * blob_size, 1.5 * blob_size}) {
+            for (size_t min_points : {1, 4, 10}) {
+                vector<int> ref =
+                        ClusterDBSCANSerial(pc.points_, eps, min_points);
+                ExpectEQ(ref, pc.ClusterDBSCAN(eps, min_points));
+            }
+        }
+    }
+}
+
 TEST(PointCloud, SegmentPlane) {
     // Points sampled from the plane x + y + z + 1 = 0
     vector<Vector3d> ref = {{1.0, 1.0, -3.0},
-                            {2.0, 2.0, -5.0},
+                            {2.0, 0.0, -3.0},
                             {-1.0, -1.0, 1.0},
-                            {-2.0, -2.0, 3.0},
-                            {10.0, 10.0, -21.0}};
+                            {0.0, -2.0, 1.0},
+                            {10.0, -5.0, -6.0}};
 
     geometry::PointCloud pc;
 
@@ -1078,3 +1279,318 @@ TEST(PointCloud, SegmentPlane) {
 
     ExpectEQ(ref, output_pc->points_);
 }
+
+namespace {
+
+/// Points of the planes z = 0, x = 2 and y = 3 in decreasing number, followed
+/// by random outliers.
+geometry::PointCloud CreatePlanes() {
+    geometry::PointCloud pc;
+    vector<Vector2d, utility::Vector2d_allocator> uv(2000);
+    Rand(uv, Vector2d(-1.0, -1.0), Vector2d(1.0, 1.0), 0);
+    for (size_t i = 0; i < 1000; i++) {
+        pc.points_.push_back(Vector3d(uv[i](0), uv[i](1), 0.0));
+    }
+    for (size_t i = 1000; i < 1600; i++) {
+        pc.points_.push_back(Vector3d(2.0, uv[i](0), uv[i](1) + 1.5));
+    }
+    for (size_t i = 1600; i < 2000; i++) {
+        pc.points_.push_back(Vector3d(uv[i](0) - 2.0, 3.0, uv[i](1) + 1.5));
+    }
+    vector<Vector3d> outliers(200);
+    Rand(outliers, Vector3d(-5.0, -5.0, 1.0), Vector3d(5.0, 5.0, 5.0), 1);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+    return pc;
+}
+
+void ExpectPlaneEQ(const Vector4d &ref, const Vector4d &plane_model) {
+    // Up to the sign, and to the few outliers that fall within the distance
+    // threshold and tilt the refined plane.
+    double sign = ref.dot(plane_model) < 0 ? -1.0 : 1.0;
+    ExpectEQ(ref, Vector4d(sign * plane_model), 1e-2);
+}
+
+}  // unnamed namespace
+
+TEST(PointCloud, SegmentPlaneAdaptive) {
+    geometry::PointCloud pc = CreatePlanes();
+
+    // The largest plane holds almost half of the points, which a few dozen
+    // iterations find.
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pc.SegmentPlane(0.01, 3, 100000);
+    ExpectPlaneEQ(Vector4d(0.0, 0.0, 1.0, 0.0), plane_model);
+    EXPECT_GE(inliers.size(), 1000u);
+    for (size_t i = 0; i < 1000; i++) {
+        EXPECT_EQ(i, inliers[i]);
+    }
+
+    // Scored on a subsample, verified on all points.
+    std::tie(plane_model, inliers) = pc.SegmentPlane(0.01, 3, 100000,
+                                                     0.99999999, 200);
+    ExpectPlaneEQ(Vector4d(0.0, 0.0, 1.0, 0.0), plane_model);
+    EXPECT_GE(inliers.size(), 1000u);
+}
+
+TEST(PointCloud, SegmentPlanes) {
+    geometry::PointCloud pc = CreatePlanes();
+
+    auto planes = pc.SegmentPlanes(5, 0.01, 3, 1000, 0.99999999, 0, 100);
+    ASSERT_EQ(planes.size(), 3u);
+    ExpectPlaneEQ(Vector4d(0.0, 0.0, 1.0, 0.0), std::get<0>(planes[0]));
+    ExpectPlaneEQ(Vector4d(1.0, 0.0, 0.0, -2.0), std::get<0>(planes[1]));
+    ExpectPlaneEQ(Vector4d(0.0, 1.0, 0.0, -3.0), std::get<0>(planes[2]));
+
+    // Every point belongs to one plane at most.
+    vector<int> plane_of(pc.points_.size(), -1);
+    for (int p = 0; p < 3; p++) {
+        for (size_t i : std::get<1>(planes[p])) {
+            EXPECT_EQ(plane_of[i], -1);
+            plane_of[i] = p;
+        }
+    }
+    // A hypothesis slightly tilted within the distance threshold may trade
+    // a point at the edge of a plane for an outlier.
+    vector<size_t> num_found(3, 0);
+    for (size_t i = 0; i < 2000; i++) {
+        int p = i < 1000 ? 0 : (i < 1600 ? 1 : 2);
+        if (plane_of[i] == p) num_found[p]++;
+    }
+    EXPECT_GE(num_found[0], 990u);
+    EXPECT_GE(num_found[1], 590u);
+    EXPECT_GE(num_found[2], 390u);
+}
+
+TEST(PointCloud, SegmentPlanesCollinear) {
+    // No plane can be sampled from collinear points.
+    geometry::PointCloud line;
+    for (int i = 0; i < 50; i++) {
+        line.points_.push_back(Vector3d(5.0, 5.0, 1.0 + 0.1 * i));
+    }
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = line.SegmentPlane(0.01, 3, 100);
+    EXPECT_TRUE(plane_model.isZero(0));
+    EXPECT_TRUE(inliers.empty());
+
+    // The segmentation stops once only the line is left.
+    geometry::PointCloud pc;
+    pc.points_.resize(500);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 0.0), 0);
+    pc += line;
+    auto planes = pc.SegmentPlanes(5, 0.01, 3, 1000);
+    ASSERT_EQ(planes.size(), 1u);
+    ExpectPlaneEQ(Vector4d(0.0, 0.0, 1.0, 0.0), std::get<0>(planes[0]));
+    EXPECT_EQ(std::get<1>(planes[0]).size(), 500u);
+}
+
+// ----------------------------------------------------------------------------
+// Organized point cloud of the plane normal.dot(p) = 1 seen by a 64 x 48
+// camera, with invalid depth at every 7-th pixel.
+// ----------------------------------------------------------------------------
+namespace {
+
+std::shared_ptr<geometry::PointCloud> CreateOrganizedPlane(
+        const Vector3d &normal,
+        int stride = 1,
+        bool project_valid_depth_only = false) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::Image depth;
+    depth.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            Vector3d ray((u - 31.5) / 50.0, (v - 23.5) / 50.0, 1.0);
+            *depth.PointerAt<float>(u, v) =
+                    (v * 64 + u) % 7 == 3 ? 0.0f
+                                          : float(1.0 / normal.dot(ray));
+        }
+    }
+    return geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsic, Matrix4d::Identity(), 1000.0, 1000.0, stride,
+            project_valid_depth_only);
+}
+
+}  // unnamed namespace
+
+TEST(PointCloud, CreateOrganizedPointCloudFromDepthImage) {
+    auto pc = CreateOrganizedPlane(Vector3d(0.0, 0.0, 1.0));
+    EXPECT_TRUE(pc->IsOrganized());
+    EXPECT_EQ(pc->width_, 64);
+    EXPECT_EQ(pc->height_, 48);
+    EXPECT_TRUE(std::isnan(pc->points_[3](2)));
+    ExpectEQ(pc->points_[2 * 64 + 5],
+             Vector3d((5 - 31.5) / 50.0, (2 - 23.5) / 50.0, 1.0), 1e-6);
+
+    // Strides that do not divide the image size keep the last row and column.
+    pc = CreateOrganizedPlane(Vector3d(0.0, 0.0, 1.0), 5);
+    EXPECT_TRUE(pc->IsOrganized());
+    EXPECT_EQ(pc->width_, 13);
+    EXPECT_EQ(pc->height_, 10);
+    ExpectEQ(pc->points_[12], Vector3d((60 - 31.5) / 50.0, -23.5 / 50.0, 1.0),
+             1e-6);
+
+    // Adding points drops the layout.
+    *pc += geometry::PointCloud({Vector3d::Zero()});
+    EXPECT_FALSE(pc->IsOrganized());
+    pc->Clear();
+    EXPECT_EQ(pc->width_, 0);
+    EXPECT_EQ(pc->height_, 0);
+
+    pc = CreateOrganizedPlane(Vector3d(0.0, 0.0, 1.0), 1, true);
+    EXPECT_FALSE(pc->IsOrganized());
+}
+
+TEST(PointCloud, EstimateNormalsOrganized) {
+    Vector3d normal = Vector3d(0.1, -0.2, 1.0).normalized();
+    auto pc = CreateOrganizedPlane(normal);
+    EXPECT_TRUE(pc->EstimateNormalsOrganized(2, 0.1));
+    ASSERT_TRUE(pc->HasNormals());
+    for (size_t i = 0; i < pc->points_.size(); i++) {
+        if (pc->points_[i].allFinite()) {
+            EXPECT_NEAR(std::abs(pc->normals_[i].dot(normal)), 1.0, 1e-6);
+        } else {
+            EXPECT_TRUE(std::isnan(pc->normals_[i](0)));
+        }
+    }
+
+    // Existing normals orient the new ones.
+    for (auto &n : pc->normals_) n = -normal;
+    EXPECT_TRUE(pc->EstimateNormalsOrganized(2, 0.1));
+    for (size_t i = 0; i < pc->points_.size(); i++) {
+        if (pc->points_[i].allFinite()) {
+            ExpectEQ(pc->normals_[i], Vector3d(-normal), 1e-6);
+        }
+    }
+
+    geometry::PointCloud unorganized({Vector3d::Zero(), Vector3d::Ones()});
+    EXPECT_FALSE(unorganized.EstimateNormalsOrganized());
+}
+
+TEST(PointCloud, RemoveRadiusOutliersOrganized) {
+    auto pc = CreateOrganizedPlane(Vector3d(0.0, 0.0, 1.0));
+    pc->PaintUniformColor(Vector3d(0.5, 0.5, 0.5));
+    // A flying pixel in front of the plane.
+    pc->points_[20 * 64 + 30](2) = 0.5;
+
+    std::shared_ptr<geometry::PointCloud> output;
+    std::vector<size_t> indices;
+    std::tie(output, indices) = pc->RemoveRadiusOutliersOrganized(5, 0.1, 2);
+    EXPECT_TRUE(output->IsOrganized());
+    EXPECT_TRUE(std::isnan(output->points_[20 * 64 + 30](2)));
+    EXPECT_TRUE(std::isnan(output->colors_[20 * 64 + 30](0)));
+    size_t num_valid = 0;
+    for (size_t i = 0; i < pc->points_.size(); i++) {
+        if (pc->points_[i].allFinite()) num_valid++;
+    }
+    EXPECT_EQ(indices.size(), num_valid - 1);
+    for (size_t i : indices) {
+        ExpectEQ(output->points_[i], pc->points_[i]);
+    }
+}
+
+TEST(PointCloud, DownSampleOrganized) {
+    auto pc = CreateOrganizedPlane(Vector3d(0.0, 0.0, 1.0));
+    pc->PaintUniformColor(Vector3d(0.2, 0.4, 0.6));
+    pc->normals_.assign(pc->points_.size(), Vector3d(0.0, 0.0, -1.0));
+
+    auto output = pc->DownSampleOrganized(5);
+    EXPECT_TRUE(output->IsOrganized());
+    EXPECT_EQ(output->width_, 13);
+    EXPECT_EQ(output->height_, 10);
+    // The mean of the valid points of the first block.
+    Vector3d mean = Vector3d::Zero();
+    int count = 0;
+    for (int v = 0; v < 5; v++) {
+        for (int u = 0; u < 5; u++) {
+            if (pc->points_[v * 64 + u].allFinite()) {
+                mean += pc->points_[v * 64 + u];
+                count++;
+            }
+        }
+    }
+    ExpectEQ(output->points_[0], Vector3d(mean / count));
+    // The last column only spans 4 pixels.
+    EXPECT_NEAR(output->points_[12](0), (61.5 - 31.5) / 50.0, 0.02);
+    for (size_t i = 0; i < output->points_.size(); i++) {
+        ExpectEQ(output->colors_[i], Vector3d(0.2, 0.4, 0.6));
+        ExpectEQ(output->normals_[i], Vector3d(0.0, 0.0, -1.0));
+    }
+}
+
+TEST(PointCloud, RemoveRadiusOutliers) {
+    size_t size = 500;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    pc.colors_.resize(size);
+    Rand(pc.colors_, Vector3d::Zero(), Vector3d::Ones(), 1);
+
+    // Brute force: a point is kept when more than nb_points points, itself
+    // included, lie within the radius.
+    size_t nb_points = 3;
+    double radius = 1.5;
+    vector<size_t> ref_indices;
+    for (size_t i = 0; i < size; i++) {
+        size_t count = 0;
+        for (size_t j = 0; j < size; j++) {
+            if ((pc.points_[i] - pc.points_[j]).squaredNorm() <
+                radius * radius) {
+                count++;
+            }
+        }
+        if (count > nb_points) ref_indices.push_back(i);
+    }
+    EXPECT_GT(ref_indices.size(), 0u);
+    EXPECT_LT(ref_indices.size(), size);
+
+    std::shared_ptr<geometry::PointCloud> output;
+    vector<size_t> indices;
+    std::tie(output, indices) = pc.RemoveRadiusOutliers(nb_points, radius);
+    EXPECT_EQ(ref_indices, indices);
+    EXPECT_EQ(indices.size(), output->points_.size());
+    EXPECT_EQ(indices.size(), output->colors_.size());
+    for (size_t k = 0; k < indices.size(); k++) {
+        ExpectEQ(pc.points_[indices[k]], output->points_[k]);
+        ExpectEQ(pc.colors_[indices[k]], output->colors_[k]);
+    }
+
+    // The removed points are the complement.
+    auto removed = pc.SelectByIndex(indices, true);
+    EXPECT_EQ(size - indices.size(), removed->points_.size());
+
+    // More neighbors than points are never found, even with a huge radius.
+    for (size_t large : {size, size_t(std::numeric_limits<int>::max()),
+                         std::numeric_limits<size_t>::max()}) {
+        std::tie(output, indices) = pc.RemoveRadiusOutliers(large, 100.0);
+        EXPECT_TRUE(indices.empty());
+    }
+    std::tie(output, indices) = pc.RemoveRadiusOutliers(size - 1, 100.0);
+    EXPECT_EQ(indices.size(), size);
+}
+
+TEST(PointCloud, RemoveStatisticalOutliers) {
+    size_t size = 500;
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    // Far away points are outliers.
+    pc.points_.push_back(Vector3d(100.0, 0.0, 0.0));
+    pc.points_.push_back(Vector3d(0.0, 100.0, 0.0));
+
+    std::shared_ptr<geometry::PointCloud> output;
+    vector<size_t> indices;
+    std::tie(output, indices) = pc.RemoveStatisticalOutliers(10, 1.0);
+    EXPECT_EQ(indices.size(), output->points_.size());
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_GT(indices.size(), size / 2);
+    EXPECT_LT(indices.back(), size);
+}
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudFloat.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(PointCloudFloat, Constructor) {
+    geometry::PointCloudFloat pc;
+
+    EXPECT_EQ(geometry::Geometry::GeometryType::PointCloudFloat,
+              pc.GetGeometryType());
+    EXPECT_EQ(3, pc.Dimension());
+
+    EXPECT_EQ(0u, pc.points_.size());
+    EXPECT_EQ(0u, pc.normals_.size());
+    EXPECT_EQ(0u, pc.colors_.size());
+
+    EXPECT_TRUE(pc.IsEmpty());
+    ExpectEQ(Zero3d, pc.GetMinBound());
+    ExpectEQ(Zero3d, pc.GetMaxBound());
+}
+
+TEST(PointCloudFloat, GetMinMaxBoundCenter) {
+    geometry::PointCloudFloat pc({{1.0f, 2.0f, 3.0f},
+                                  {-1.0f, 4.0f, 0.0f},
+                                  {0.0f, 0.0f, 6.0f}});
+
+    ExpectEQ(Vector3d(-1.0, 0.0, 0.0), pc.GetMinBound());
+    ExpectEQ(Vector3d(1.0, 4.0, 6.0), pc.GetMaxBound());
+    ExpectEQ(Vector3d(0.0, 2.0, 3.0), pc.GetCenter());
+}
+
+TEST(PointCloudFloat, Transform) {
+    geometry::PointCloudFloat pc({{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}});
+    pc.normals_ = {{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}};
+
+    Matrix4d transformation;
+    transformation << 0.0, -1.0, 0.0, 1.0, 1.0, 0.0, 0.0, 2.0, 0.0, 0.0, 1.0,
+            3.0, 0.0, 0.0, 0.0, 1.0;
+    pc.Transform(transformation);
+
+    ExpectEQ(vector<Vector3f>({{-1.0f, 3.0f, 6.0f}, {-4.0f, 6.0f, 9.0f}}),
+             pc.points_);
+    ExpectEQ(vector<Vector3f>({{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}}),
+             pc.normals_);
+}
+
+TEST(PointCloudFloat, Crop) {
+    geometry::PointCloudFloat pc({{0.0f, 0.0f, 0.0f},
+                                  {0.5f, 0.5f, 0.5f},
+                                  {1.0f, 1.0f, 1.0f},
+                                  {2.0f, 0.5f, 0.5f}});
+    pc.PaintUniformColor(Vector3d(0.2, 0.4, 0.6));
+
+    auto cropped = pc.Crop(geometry::AxisAlignedBoundingBox(
+            Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0)));
+
+    ExpectEQ(vector<Vector3f>({{0.0f, 0.0f, 0.0f},
+                               {0.5f, 0.5f, 0.5f},
+                               {1.0f, 1.0f, 1.0f}}),
+             cropped->points_);
+    EXPECT_TRUE(cropped->HasColors());
+    EXPECT_FALSE(cropped->HasNormals());
+}
+
+TEST(PointCloudFloat, VoxelDownSample) {
+    geometry::PointCloudFloat pc({{0.1f, 0.1f, 0.1f},
+                                  {0.3f, 0.5f, 0.5f},
+                                  {2.0f, 0.2f, 0.2f},
+                                  {2.4f, 0.4f, 0.4f}});
+    pc.colors_ = {{0.0f, 0.0f, 0.0f},
+                  {1.0f, 1.0f, 1.0f},
+                  {0.2f, 0.2f, 0.2f},
+                  {0.4f, 0.4f, 0.4f}};
+
+    auto output = pc.VoxelDownSample(1.0)->ToPointCloud();
+    Sort::Do(output->points_);
+    Sort::Do(output->colors_);
+
+    ExpectEQ(vector<Vector3d>({{0.2, 0.3, 0.3}, {2.2, 0.3, 0.3}}),
+             output->points_);
+    ExpectEQ(vector<Vector3d>({{0.3, 0.3, 0.3}, {0.5, 0.5, 0.5}}),
+             output->colors_);
+
+    // The voxel grid of a float cloud matches the one of the double cloud.
+    geometry::PointCloud pc_double;
+    pc_double.points_.resize(1000);
+    Rand(pc_double.points_, Zero3d, Vector3d(10.0, 10.0, 10.0), 0);
+    auto pc_float = geometry::PointCloudFloat::CreateFromPointCloud(pc_double);
+    EXPECT_EQ(pc_double.VoxelDownSample(2.5)->points_.size(),
+              pc_float->VoxelDownSample(2.5)->points_.size());
+}
+
+TEST(PointCloudFloat, EstimateNormals) {
+    geometry::PointCloudFloat pc;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            pc.points_.push_back(Vector3f(0.1f * i, 0.1f * j, 0.0f));
+        }
+    }
+
+    EXPECT_TRUE(pc.EstimateNormals(geometry::KDTreeSearchParamKNN(8)));
+
+    ASSERT_EQ(pc.points_.size(), pc.normals_.size());
+    for (const auto &normal : pc.normals_) {
+        EXPECT_NEAR(1.0f, std::abs(normal(2)), 1e-5);
+    }
+}
+
+TEST(PointCloudFloat, KDTreeFlannSearch) {
+    geometry::PointCloud pc_double;
+    pc_double.points_.resize(100);
+    Rand(pc_double.points_, Zero3d, Vector3d(1.0, 1.0, 1.0), 0);
+    auto pc = geometry::PointCloudFloat::CreateFromPointCloud(pc_double);
+
+    geometry::KDTreeFlann kdtree_double(pc_double);
+    geometry::KDTreeFlann kdtree(*pc);
+
+    for (size_t i = 0; i < pc->points_.size(); i += 10) {
+        vector<int> indices_ref, indices;
+        vector<double> distance2_ref, distance2;
+        kdtree_double.SearchKNN(pc_double.points_[i], 5, indices_ref,
+                                distance2_ref);
+        EXPECT_EQ(5, kdtree.SearchKNN(pc->points_[i], 5, indices, distance2));
+        EXPECT_EQ(indices_ref, indices);
+        ExpectEQ(distance2_ref, distance2, 1e-5);
+
+        // Double precision queries are converted for the float index.
+        EXPECT_EQ(5, kdtree.SearchKNN(pc_double.points_[i], 5, indices,
+                                      distance2));
+        EXPECT_EQ(indices_ref, indices);
+
+        kdtree_double.SearchRadius(pc_double.points_[i], 0.3, indices_ref,
+                                   distance2_ref);
+        kdtree.SearchRadius(pc->points_[i], 0.3, indices, distance2);
+        sort(indices_ref.begin(), indices_ref.end());
+        sort(indices.begin(), indices.end());
+        EXPECT_EQ(indices_ref, indices);
+    }
+
+    // Batched queries go through the float index as well.
+    Map<const MatrixXd> queries((const double *)pc_double.points_.data(), 3,
+                                pc_double.points_.size());
+    vector<int> indices_ref, indices;
+    vector<double> distance2_ref, distance2;
+    vector<size_t> offsets_ref, offsets;
+    EXPECT_EQ(500, kdtree_double.SearchKNNBatch(queries, 5, indices_ref,
+                                                distance2_ref));
+    EXPECT_EQ(500, kdtree.SearchKNNBatch(queries, 5, indices, distance2));
+    EXPECT_EQ(indices_ref, indices);
+    ExpectEQ(distance2_ref, distance2, 1e-5);
+
+    kdtree_double.SearchRadiusBatch(queries, 0.3, indices_ref, distance2_ref,
+                                    offsets_ref);
+    kdtree.SearchRadiusBatch(queries, 0.3, indices, distance2, offsets);
+    EXPECT_EQ(offsets_ref, offsets);
+}
+
+TEST(PointCloudFloat, CreateFromPointCloud) {
+    geometry::PointCloud pc_double;
+    pc_double.points_ = {{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    pc_double.normals_ = {{0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}};
+    pc_double.colors_ = {{0.1, 0.2, 0.3}, {0.4, 0.5, 0.6}};
+
+    auto pc = geometry::PointCloudFloat::CreateFromPointCloud(pc_double);
+    ExpectEQ(vector<Vector3f>({{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}}),
+             pc->points_);
+
+    auto pc_back = pc->ToPointCloud();
+    ExpectEQ(pc_double.points_, pc_back->points_);
+    ExpectEQ(pc_double.normals_, pc_back->normals_);
+    ExpectEQ(pc_double.colors_, pc_back->colors_);
+}
@@ -0,0 +1,332 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <limits>
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Triangles of about 1 at random in [0:extent]^3, some of them sharing
+// vertices with the previous one.
+geometry::TriangleMesh CreateTriangleSoup(int size, double extent, int seed) {
+    geometry::TriangleMesh mesh;
+    vector<Vector3d> centers(size);
+    Rand(centers, Vector3d::Zero(), Vector3d::Constant(extent), seed);
+    mesh.vertices_.resize(3 * size);
+    Rand(mesh.vertices_, Vector3d::Constant(-0.5), Vector3d::Constant(0.5),
+         seed + 1);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < 3; j++) mesh.vertices_[3 * i + j] += centers[i];
+        mesh.triangles_.push_back(Vector3i(3 * i, 3 * i + 1, 3 * i + 2));
+        if (i > 0 && i % 4 == 0) {
+            mesh.triangles_.push_back(Vector3i(3 * i - 3, 3 * i, 3 * i + 1));
+        }
+    }
+    return mesh;
+}
+
+bool ShareVertex(const Vector3i &p, const Vector3i &q) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            if (p(i) == q(j)) return true;
+        }
+    }
+    return false;
+}
+
+vector<Vector2i> BruteForceSelfIntersectingTriangles(
+        const geometry::TriangleMesh &mesh) {
+    vector<Vector2i> pairs;
+    const auto &v = mesh.vertices_;
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const Vector3i &p = mesh.triangles_[i];
+        for (size_t j = i + 1; j < mesh.triangles_.size(); j++) {
+            const Vector3i &q = mesh.triangles_[j];
+            if (!ShareVertex(p, q) &&
+                geometry::IntersectionTest::TriangleTriangle3d(
+                        v[p(0)], v[p(1)], v[p(2)], v[q(0)], v[q(1)],
+                        v[q(2)])) {
+                pairs.push_back(Vector2i(i, j));
+            }
+        }
+    }
+    return pairs;
+}
+
+Vector3d ClosestPointOnSegment(const Vector3d &p,
+                               const Vector3d &a,
+                               const Vector3d &b) {
+    const double s = (p - a).dot(b - a) / (b - a).squaredNorm();
+    return a + min(max(s, 0.0), 1.0) * (b - a);
+}
+
+// Projects on the plane of the triangle if inside, else on its edges.
+double DistanceToTriangle(const Vector3d &p,
+                          const Vector3d &a,
+                          const Vector3d &b,
+                          const Vector3d &c) {
+    const Vector3d n = (b - a).cross(c - a);
+    const Vector3d q = p - (p - a).dot(n) / n.squaredNorm() * n;
+    if ((b - a).cross(q - a).dot(n) >= 0 && (c - b).cross(q - b).dot(n) >= 0 &&
+        (a - c).cross(q - c).dot(n) >= 0) {
+        return (p - q).norm();
+    }
+    return min({(p - ClosestPointOnSegment(p, a, b)).norm(),
+                (p - ClosestPointOnSegment(p, b, c)).norm(),
+                (p - ClosestPointOnSegment(p, c, a)).norm()});
+}
+
+}  // namespace
+
+TEST(TriangleMeshBVH, SetGeometry) {
+    geometry::TriangleMeshBVH bvh;
+    EXPECT_FALSE(bvh.SetGeometry(geometry::TriangleMesh()));
+    EXPECT_TRUE(bvh.GetNodes().empty());
+
+    auto mesh = CreateTriangleSoup(1000, 10.0, 0);
+    EXPECT_TRUE(bvh.SetGeometry(mesh));
+
+    // Every triangle is in one leaf, inside the bounds of its ancestors.
+    const auto &nodes = bvh.GetNodes();
+    const auto &indices = bvh.GetTriangleIndices();
+    vector<int> sorted_indices(indices);
+    sort(sorted_indices.begin(), sorted_indices.end());
+    for (size_t i = 0; i < sorted_indices.size(); i++) {
+        EXPECT_EQ(sorted_indices[i], int(i));
+    }
+    size_t num_triangles = 0;
+    for (size_t n = 0; n < nodes.size(); n++) {
+        const auto &node = nodes[n];
+        num_triangles += node.num_triangles_;
+        if (!node.IsLeaf()) {
+            for (int child : {int(n) + 1, node.offset_}) {
+                EXPECT_TRUE((node.min_bound_.array() <=
+                             nodes[child].min_bound_.array())
+                                    .all());
+                EXPECT_TRUE((node.max_bound_.array() >=
+                             nodes[child].max_bound_.array())
+                                    .all());
+            }
+            continue;
+        }
+        for (int k = node.offset_; k < node.offset_ + node.num_triangles_;
+             k++) {
+            for (int j = 0; j < 3; j++) {
+                const Vector3d &v =
+                        mesh.vertices_[mesh.triangles_[indices[k]](j)];
+                EXPECT_TRUE((node.min_bound_.cast<double>().array() <=
+                             v.array())
+                                    .all());
+                EXPECT_TRUE((node.max_bound_.cast<double>().array() >=
+                             v.array())
+                                    .all());
+            }
+        }
+    }
+    EXPECT_EQ(num_triangles, mesh.triangles_.size());
+}
+
+TEST(TriangleMeshBVH, ForEachTriangleInBox) {
+    auto mesh = CreateTriangleSoup(1000, 10.0, 0);
+    geometry::TriangleMeshBVH bvh(mesh);
+
+    vector<Vector3d> corners(100);
+    Rand(corners, Vector3d::Constant(-1.0), Vector3d::Constant(10.0), 1);
+    for (const Vector3d &corner : corners) {
+        const Vector3d min_bound = corner;
+        const Vector3d max_bound = corner + Vector3d(1.0, 2.0, 0.5);
+        vector<int> ref;
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            AlignedBox3d box;
+            for (int j = 0; j < 3; j++) {
+                box.extend(mesh.vertices_[mesh.triangles_[i](j)]);
+            }
+            if (box.intersects(AlignedBox3d(min_bound, max_bound))) {
+                ref.push_back(int(i));
+            }
+        }
+        vector<int> found;
+        EXPECT_TRUE(bvh.ForEachTriangleInBox(min_bound, max_bound, [&](int i) {
+            found.push_back(i);
+            return true;
+        }));
+        sort(found.begin(), found.end());
+        EXPECT_EQ(found, ref);
+
+        // Stops at the first triangle.
+        int count = 0;
+        EXPECT_EQ(bvh.ForEachTriangleInBox(min_bound, max_bound,
+                                           [&](int) {
+                                               count++;
+                                               return false;
+                                           }),
+                  ref.empty());
+        EXPECT_EQ(count, ref.empty() ? 0 : 1);
+    }
+}
+
+TEST(TriangleMeshBVH, ClosestPoint) {
+    auto mesh = CreateTriangleSoup(1000, 10.0, 0);
+    geometry::TriangleMeshBVH bvh(mesh);
+
+    vector<Vector3d> queries(100);
+    Rand(queries, Vector3d::Constant(-2.0), Vector3d::Constant(12.0), 1);
+    for (const Vector3d &query : queries) {
+        double ref = numeric_limits<double>::infinity();
+        for (const Vector3i &t : mesh.triangles_) {
+            ref = min(ref, DistanceToTriangle(query, mesh.vertices_[t(0)],
+                                              mesh.vertices_[t(1)],
+                                              mesh.vertices_[t(2)]));
+        }
+        Vector3d closest_point;
+        int triangle = -1;
+        const double distance =
+                bvh.ClosestPoint(query, closest_point, triangle);
+        EXPECT_NEAR(distance, ref, 1e-9);
+        EXPECT_NEAR((closest_point - query).norm(), distance, 1e-9);
+        ASSERT_GE(triangle, 0);
+        const Vector3i &t = mesh.triangles_[triangle];
+        EXPECT_NEAR(DistanceToTriangle(closest_point, mesh.vertices_[t(0)],
+                                       mesh.vertices_[t(1)],
+                                       mesh.vertices_[t(2)]),
+                    0.0, 1e-9);
+    }
+
+    Vector3d closest_point;
+    int triangle;
+    EXPECT_EQ(geometry::TriangleMeshBVH().ClosestPoint(Vector3d::Zero(),
+                                                       closest_point, triangle),
+              -1);
+}
+
+TEST(TriangleMeshBVH, RayCast) {
+    auto mesh = CreateTriangleSoup(1000, 10.0, 0);
+    geometry::TriangleMeshBVH bvh(mesh);
+
+    vector<Vector3d> origins(100);
+    vector<Vector3d> directions(100);
+    Rand(origins, Vector3d::Constant(-2.0), Vector3d::Constant(12.0), 1);
+    Rand(directions, Vector3d::Constant(-1.0), Vector3d::Constant(1.0), 2);
+    // Rays along an axis have zero components.
+    directions[0] = Vector3d(1.0, 0.0, 0.0);
+    directions[1] = Vector3d(0.0, -1.0, 0.0);
+    int num_hits = 0;
+    for (size_t r = 0; r < origins.size(); r++) {
+        const Vector3d &o = origins[r];
+        const Vector3d &d = directions[r];
+        double ref_t = numeric_limits<double>::infinity();
+        int ref_triangle = -1;
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const Vector3d &a = mesh.vertices_[mesh.triangles_[i](0)];
+            const Vector3d &b = mesh.vertices_[mesh.triangles_[i](1)];
+            const Vector3d &c = mesh.vertices_[mesh.triangles_[i](2)];
+            const Vector3d n = (b - a).cross(c - a);
+            const double t = (a - o).dot(n) / d.dot(n);
+            const Vector3d q = o + t * d;
+            if (t >= 0 && t < ref_t && (b - a).cross(q - a).dot(n) >= 0 &&
+                (c - b).cross(q - b).dot(n) >= 0 &&
+                (a - c).cross(q - c).dot(n) >= 0) {
+                ref_t = t;
+                ref_triangle = int(i);
+            }
+        }
+        double t;
+        int triangle;
+        const bool hit = bvh.RayCast(o, d, t, triangle);
+        EXPECT_EQ(hit, ref_triangle >= 0);
+        if (hit && ref_triangle >= 0) {
+            num_hits++;
+            EXPECT_NEAR(t, ref_t, 1e-9);
+            EXPECT_EQ(triangle, ref_triangle);
+            EXPECT_FALSE(bvh.RayCast(o, d, t, triangle, 0.5 * ref_t));
+        }
+    }
+    EXPECT_GT(num_hits, 0);
+}
+
+TEST(TriangleMeshBVH, GetSelfIntersectingTriangles) {
+    auto mesh = CreateTriangleSoup(1000, 5.0, 0);
+    auto ref = BruteForceSelfIntersectingTriangles(mesh);
+    EXPECT_FALSE(ref.empty());
+    EXPECT_EQ(geometry::TriangleMeshBVH(mesh).GetSelfIntersectingTriangles(),
+              ref);
+    EXPECT_EQ(mesh.GetSelfIntersectingTriangles(), ref);
+
+    // Copies of one triangle have the same centroid.
+    geometry::TriangleMesh copies;
+    for (int i = 0; i < 50; i++) {
+        copies.vertices_.push_back(Vector3d(0.0, 0.0, 0.0));
+        copies.vertices_.push_back(Vector3d(1.0, 0.0, 0.0));
+        copies.vertices_.push_back(Vector3d(0.0, 1.0, 0.0));
+        copies.triangles_.push_back(Vector3i(3 * i, 3 * i + 1, 3 * i + 2));
+    }
+    EXPECT_EQ(copies.GetSelfIntersectingTriangles().size(), 50u * 49u / 2u);
+
+    geometry::TriangleMesh empty;
+    EXPECT_TRUE(empty.GetSelfIntersectingTriangles().empty());
+}
+
+TEST(TriangleMeshBVH, IsIntersecting) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0);
+    auto inner = geometry::TriangleMesh::CreateSphere(0.5);
+    EXPECT_FALSE(sphere->IsIntersecting(*inner));
+    EXPECT_FALSE(inner->IsIntersecting(*sphere));
+    inner->Translate(Vector3d(0.8, 0.0, 0.0));
+    EXPECT_TRUE(sphere->IsIntersecting(*inner));
+    EXPECT_TRUE(inner->IsIntersecting(*sphere));
+    EXPECT_FALSE(sphere->IsIntersecting(geometry::TriangleMesh()));
+
+    auto mesh0 = CreateTriangleSoup(300, 10.0, 0);
+    for (int seed = 1; seed < 20; seed++) {
+        auto mesh1 = CreateTriangleSoup(50, 10.0, seed * 2);
+        bool ref = false;
+        for (const Vector3i &p : mesh0.triangles_) {
+            for (const Vector3i &q : mesh1.triangles_) {
+                ref = ref || geometry::IntersectionTest::TriangleTriangle3d(
+                                     mesh0.vertices_[p(0)],
+                                     mesh0.vertices_[p(1)],
+                                     mesh0.vertices_[p(2)],
+                                     mesh1.vertices_[q(0)],
+                                     mesh1.vertices_[q(1)],
+                                     mesh1.vertices_[q(2)]);
+            }
+        }
+        EXPECT_EQ(mesh0.IsIntersecting(mesh1), ref);
+        EXPECT_EQ(mesh1.IsIntersecting(mesh0), ref);
+    }
+}
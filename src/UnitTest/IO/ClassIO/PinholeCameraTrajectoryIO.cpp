@@ -24,8 +24,38 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+camera::PinholeCameraParameters CreateCameraParameters(int i) {
+    camera::PinholeCameraParameters parameters;
+    parameters.intrinsic_ = camera::PinholeCameraIntrinsic(
+            640 + i, 480 - i, 525.0 + i, 525.0 - i, 319.5, 239.5);
+    Eigen::Vector6d pose = Eigen::Vector6d::Random();
+    parameters.extrinsic_ = utility::TransformVector6dToMatrix4d(pose);
+    return parameters;
+}
+
+void ExpectParametersEQ(const camera::PinholeCameraParameters &p0,
+                        const camera::PinholeCameraParameters &p1) {
+    EXPECT_EQ(p0.intrinsic_.width_, p1.intrinsic_.width_);
+    EXPECT_EQ(p0.intrinsic_.height_, p1.intrinsic_.height_);
+    ExpectEQ(p0.intrinsic_.intrinsic_matrix_, p1.intrinsic_.intrinsic_matrix_,
+             0.0);
+    ExpectEQ(Eigen::Matrix4d(p0.extrinsic_), Eigen::Matrix4d(p1.extrinsic_),
+             0.0);
+}
+
+}  // unnamed namespace
+
 TEST(PinholeCameraTrajectoryIO,
      DISABLED_CreatePinholeCameraTrajectoryFromFile) {
     unit_test::NotImplemented();
@@ -46,3 +76,53 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_ReadPinholeCameraTrajectoryFromLOG) {
 TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     unit_test::NotImplemented();
 }
+
+TEST(PinholeCameraTrajectoryIO, BINWriteRead) {
+    camera::PinholeCameraTrajectory src;
+    for (int i = 0; i < 10; i++) {
+        src.parameters_.push_back(CreateCameraParameters(i));
+    }
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_trajectory.bin";
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, src));
+    camera::PinholeCameraTrajectory dst;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, dst));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    ASSERT_EQ(src.parameters_.size(), dst.parameters_.size());
+    for (size_t i = 0; i < src.parameters_.size(); i++) {
+        ExpectParametersEQ(src.parameters_[i], dst.parameters_[i]);
+    }
+}
+
+TEST(PinholeCameraTrajectoryIO, AppendPinholeCameraParametersToBIN) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_trajectory.bin";
+    std::remove(file_name.c_str());
+
+    // The first append creates the file, the others extend it in place.
+    camera::PinholeCameraTrajectory src;
+    for (int i = 0; i < 10; i++) {
+        src.parameters_.push_back(CreateCameraParameters(i));
+        EXPECT_TRUE(io::AppendPinholeCameraParametersToBIN(
+                file_name, {src.parameters_.back()}));
+    }
+    src.parameters_.push_back(CreateCameraParameters(10));
+    src.parameters_.push_back(CreateCameraParameters(11));
+    EXPECT_TRUE(io::AppendPinholeCameraParametersToBIN(
+            file_name, {src.parameters_[10], src.parameters_[11]}));
+
+    camera::PinholeCameraTrajectory dst;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, dst));
+    ASSERT_EQ(src.parameters_.size(), dst.parameters_.size());
+    for (size_t i = 0; i < src.parameters_.size(); i++) {
+        ExpectParametersEQ(src.parameters_[i], dst.parameters_[i]);
+    }
+
+    // Appending to a file of another format fails and leaves it untouched.
+    std::string log_name = std::string(TEST_DATA_DIR) + "/temp_trajectory.log";
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(log_name, src));
+    EXPECT_FALSE(io::AppendPinholeCameraParametersToBIN(log_name,
+                                                        {src.parameters_[0]}));
+    EXPECT_EQ(std::remove(log_name.c_str()), 0);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
@@ -24,8 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(PoseGraphIO, DISABLED_CreatePoseGraphFromFile) {
     unit_test::NotImplemented();
 }
@@ -33,3 +41,70 @@ TEST(PoseGraphIO, DISABLED_CreatePoseGraphFromFile) {
 TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { unit_test::NotImplemented(); }
 
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { unit_test::NotImplemented(); }
+
+TEST(PoseGraphIO, BINWriteRead) {
+    registration::PoseGraph src;
+    for (int i = 0; i < 10; i++) {
+        Eigen::Vector6d pose = Eigen::Vector6d::Random();
+        src.nodes_.push_back(registration::PoseGraphNode(
+                utility::TransformVector6dToMatrix4d(pose)));
+    }
+    for (int i = 0; i + 1 < 10; i++) {
+        Eigen::Matrix6d information = Eigen::Matrix6d::Random();
+        src.edges_.push_back(registration::PoseGraphEdge(
+                i, (i * 7 + 3) % 10,
+                src.nodes_[i].pose_.inverse() * src.nodes_[i + 1].pose_,
+                information * information.transpose(), i % 2 == 0,
+                0.1 * i));
+    }
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    EXPECT_TRUE(io::WritePoseGraph(file_name, src));
+    registration::PoseGraph dst;
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, dst));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    // Raw doubles round-trip exactly.
+    ASSERT_EQ(src.nodes_.size(), dst.nodes_.size());
+    for (size_t i = 0; i < src.nodes_.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(src.nodes_[i].pose_),
+                 Eigen::Matrix4d(dst.nodes_[i].pose_), 0.0);
+    }
+    ASSERT_EQ(src.edges_.size(), dst.edges_.size());
+    for (size_t i = 0; i < src.edges_.size(); i++) {
+        EXPECT_EQ(src.edges_[i].source_node_id_, dst.edges_[i].source_node_id_);
+        EXPECT_EQ(src.edges_[i].target_node_id_, dst.edges_[i].target_node_id_);
+        ExpectEQ(Eigen::Matrix4d(src.edges_[i].transformation_),
+                 Eigen::Matrix4d(dst.edges_[i].transformation_), 0.0);
+        ExpectEQ(Eigen::Matrix6d(src.edges_[i].information_),
+                 Eigen::Matrix6d(dst.edges_[i].information_), 0.0);
+        EXPECT_EQ(src.edges_[i].uncertain_, dst.edges_[i].uncertain_);
+        EXPECT_EQ(src.edges_[i].confidence_, dst.edges_[i].confidence_);
+    }
+}
+
+TEST(PoseGraphIO, BINReadInvalid) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    registration::PoseGraph pose_graph;
+    pose_graph.nodes_.resize(3);
+    pose_graph.edges_.push_back(registration::PoseGraphEdge(0, 1));
+    EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+
+    // Truncate the last edge array.
+    FILE *file = fopen(file_name.c_str(), "rb");
+    std::vector<char> data(4096);
+    data.resize(fread(data.data(), 1, data.size(), file));
+    fclose(file);
+    file = fopen(file_name.c_str(), "wb");
+    fwrite(data.data(), 1, data.size() - 1, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPoseGraph(file_name, pose_graph));
+
+    // A file of another type.
+    data[0] = 'X';
+    file = fopen(file_name.c_str(), "wb");
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPoseGraph(file_name, pose_graph));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
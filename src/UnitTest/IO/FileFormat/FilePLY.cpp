@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Geometry/PointCloudFloat.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(FilePLY, DISABLED_ReadVertexCallback) { unit_test::NotImplemented(); }
 
 TEST(FilePLY, DISABLED_AdvanceConsoleProgress) { unit_test::NotImplemented(); }
@@ -45,3 +50,20 @@ TEST(FilePLY, DISABLED_ReadTriangleMeshFromPLY) { unit_test::NotImplemented(); }
 TEST(FilePLY, DISABLED_WriteTriangleMeshToPLY) { unit_test::NotImplemented(); }
 
 TEST(FilePLY, DISABLED_ResetConsoleProgress) { unit_test::NotImplemented(); }
+
+TEST(FilePLY, WriteReadPointCloudFloatFromPLY) {
+    geometry::PointCloudFloat pc_gt;
+    pc_gt.points_ = {{0.1f, 0.2f, 0.3f}, {1.5f, -2.5f, 3.25f}};
+    pc_gt.normals_ = {{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}};
+    pc_gt.colors_ = {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+
+    EXPECT_TRUE(io::WritePointCloud("tmp.ply", pc_gt));
+
+    geometry::PointCloudFloat pc_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.ply", pc_test));
+
+    // Single precision values are stored without loss.
+    EXPECT_EQ(pc_gt.points_, pc_test.points_);
+    EXPECT_EQ(pc_gt.normals_, pc_test.normals_);
+    ExpectEQ(pc_gt.colors_, pc_test.colors_);
+}
@@ -24,8 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/FastGlobalRegistration.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(FastGlobalRegistration, DISABLED_FastGlobalRegistrationOption) {
     unit_test::NotImplemented();
 }
@@ -41,3 +48,43 @@ TEST(FastGlobalRegistration, DISABLED_Constructor) {
 TEST(FastGlobalRegistration, DISABLED_MemberData) {
     unit_test::NotImplemented();
 }
+
+TEST(FastGlobalRegistration, FastGlobalRegistration) {
+    const int size = 500;
+    geometry::PointCloud target;
+    target.points_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    // Source point i matches target point i, except for a third of the points
+    // whose features are shuffled into wrong matches.
+    registration::Feature target_feature;
+    target_feature.data_ = Eigen::MatrixXd::Random(8, size);
+    registration::Feature source_feature = target_feature;
+    for (int i = 0; i < size / 6; i++) {
+        source_feature.data_.col(i).swap(
+                source_feature.data_.col(i + size / 6));
+    }
+
+    registration::RegistrationResult result =
+            registration::FastGlobalRegistration(source, target, source_feature,
+                                                 target_feature);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 1e-3);
+
+    // The matching is symmetric in the two fragments.
+    result = registration::FastGlobalRegistration(target, source,
+                                                  target_feature,
+                                                  source_feature);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        Eigen::Matrix4d(transformation.inverse()),
+                        1e-3);
+}
@@ -24,14 +24,56 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/Feature.h"
+
+#include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Feature, DISABLED_Resize) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_Dimension) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_Num) { unit_test::NotImplemented(); }
 
-TEST(Feature, DISABLED_ComputeFPFHFeature) { unit_test::NotImplemented(); }
+TEST(Feature, ComputeFPFHFeature) {
+    const int size = 1000;
+    geometry::PointCloud pcd;
+    pcd.points_.resize(size);
+    pcd.normals_.resize(size);
+    unit_test::Rand(pcd.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+    unit_test::Rand(pcd.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d::Ones(), 1);
+    pcd.NormalizeNormals();
+
+    auto fpfh_knn = registration::ComputeFPFHFeature(
+            pcd, geometry::KDTreeSearchParamKNN(30));
+    auto fpfh_radius = registration::ComputeFPFHFeature(
+            pcd, geometry::KDTreeSearchParamRadius(0.1));
+    EXPECT_EQ(fpfh_knn->Dimension(), size_t(33));
+    EXPECT_EQ(fpfh_knn->Num(), size_t(size));
+
+    // Each of the three histograms adds up the normalized SPFH of the point
+    // and the normalized weighted SPFH of its neighbors.
+    for (const auto &fpfh : {fpfh_knn, fpfh_radius}) {
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < 3; j++) {
+                double sum = fpfh->data_.block<11, 1>(11 * j, i).sum();
+                if (fpfh == fpfh_radius && sum == 0.0) continue;
+                EXPECT_NEAR(sum, 200.0, 1e-3);
+            }
+        }
+    }
+
+    // The hybrid search matches the KNN and radius searches it reduces to.
+    auto fpfh_hybrid = registration::ComputeFPFHFeature(
+            pcd, geometry::KDTreeSearchParamHybrid(10.0, 30));
+    unit_test::ExpectEQ(fpfh_hybrid->data_, fpfh_knn->data_);
+    fpfh_hybrid = registration::ComputeFPFHFeature(
+            pcd, geometry::KDTreeSearchParamHybrid(0.1, size));
+    unit_test::ExpectEQ(fpfh_hybrid->data_, fpfh_radius->data_);
+}
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { unit_test::NotImplemented(); }
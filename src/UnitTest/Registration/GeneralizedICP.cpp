@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GeneralizedICP.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+TEST(GeneralizedICP, RegistrationGeneralizedICP) {
+    const int size = 1000;
+    geometry::PointCloud target;
+    target.points_.resize(size);
+    target.normals_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+    unit_test::Rand(target.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d::Ones(), 1);
+    target.NormalizeNormals();
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, -0.01, 0.005);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    registration::RegistrationResult result =
+            registration::RegistrationGeneralizedICP(source, target, 0.05);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation);
+    EXPECT_NEAR(result.fitness_, 1.0, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, unit_test::THRESHOLD_1E_6);
+
+    // A robust kernel converges to the same alignment.
+    result = registration::RegistrationGeneralizedICP(
+            source, target, 0.05, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationForGeneralizedICP(
+                    1e-3, std::make_shared<registration::CauchyLoss>(0.01)));
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation);
+
+    // A null kernel is the L2Loss.
+    registration::TransformationEstimationForGeneralizedICP estimation;
+    registration::TransformationEstimationForGeneralizedICP null_estimation(
+            1e-3, nullptr);
+    registration::CorrespondenceSet corres(size);
+    for (int i = 0; i < size; i++) {
+        corres[i] = Eigen::Vector2i(i, i);
+    }
+    unit_test::ExpectEQ(
+            null_estimation.ComputeTransformation(source, target, corres),
+            estimation.ComputeTransformation(source, target, corres));
+
+    // Both point clouds need normals.
+    source.normals_.clear();
+    EXPECT_ANY_THROW(
+            registration::RegistrationGeneralizedICP(source, target, 0.05));
+}
+
+TEST(GeneralizedICP, ComputeRMSE) {
+    // Two points offset along the normal of one and within the surface of the
+    // other, so the combined covariance is diag(1 + epsilon, 2, 1 + epsilon).
+    geometry::PointCloud source, target;
+    source.points_ = {Eigen::Vector3d(0.0, 0.0, 0.0)};
+    source.normals_ = {Eigen::Vector3d(1.0, 0.0, 0.0)};
+    target.points_ = {Eigen::Vector3d(0.0, 0.0, 0.5)};
+    target.normals_ = {Eigen::Vector3d(0.0, 0.0, 1.0)};
+    registration::CorrespondenceSet corres = {Eigen::Vector2i(0, 0)};
+
+    const double epsilon = 1e-3;
+    registration::TransformationEstimationForGeneralizedICP estimation(
+            epsilon);
+    EXPECT_NEAR(estimation.ComputeRMSE(source, target, corres),
+                0.5 / std::sqrt(1.0 + epsilon), unit_test::THRESHOLD_1E_6);
+    EXPECT_EQ(estimation.GetTransformationEstimationType(),
+              registration::TransformationEstimationType::GeneralizedICP);
+}
@@ -24,14 +24,135 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
+#include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// A loop of poses on a circle. The odometry edges are perturbed, the loop
+/// closure edges are exact, and the nodes are initialized by chaining the
+/// odometry.
+registration::PoseGraph CreateLoopPoseGraph(int n_nodes) {
+    std::vector<Eigen::Matrix4d> ground_truth(n_nodes);
+    for (int i = 0; i < n_nodes; i++) {
+        double angle = 2.0 * M_PI * i / n_nodes;
+        Eigen::Vector6d pose;
+        pose << 0.0, 0.0, angle, std::cos(angle), std::sin(angle), 0.1 * i;
+        ground_truth[i] = utility::TransformVector6dToMatrix4d(pose);
+    }
+
+    registration::PoseGraph pose_graph;
+    pose_graph.nodes_.push_back(registration::PoseGraphNode(ground_truth[0]));
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 1000.0;
+    for (int i = 0; i + 1 < n_nodes; i++) {
+        Eigen::Vector6d noise;
+        noise << 0.01, -0.01, 0.02, 0.01 * (i % 3), -0.02, 0.01;
+        Eigen::Matrix4d odometry = utility::TransformVector6dToMatrix4d(noise) *
+                                   ground_truth[i + 1].inverse() *
+                                   ground_truth[i];
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i, i + 1, odometry, information, false));
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(
+                pose_graph.nodes_[i].pose_ * odometry.inverse()));
+    }
+    for (int i = 0; i + 5 < n_nodes; i += 3) {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i, i + 5, ground_truth[i + 5].inverse() * ground_truth[i],
+                information, true));
+    }
+    return pose_graph;
+}
+
+// Nothing anchors the graph, so the solvers may settle on different rigid
+// transformations of the whole graph; compare poses relative to the first node.
+void ExpectPoseGraphNodesEQ(const registration::PoseGraph &pose_graph0,
+                            const registration::PoseGraph &pose_graph1,
+                            double threshold) {
+    EXPECT_EQ(pose_graph0.nodes_.size(), pose_graph1.nodes_.size());
+    for (size_t i = 0; i < pose_graph0.nodes_.size(); i++) {
+        unit_test::ExpectEQ(Eigen::Matrix4d(
+                                    pose_graph0.nodes_[0].pose_.inverse() *
+                                    pose_graph0.nodes_[i].pose_),
+                            Eigen::Matrix4d(
+                                    pose_graph1.nodes_[0].pose_.inverse() *
+                                    pose_graph1.nodes_[i].pose_),
+                            threshold);
+    }
+}
+
+void TestSparseMatchesDense(
+        const registration::GlobalOptimizationMethod &method,
+        double threshold) {
+    registration::PoseGraph pose_graph_init = CreateLoopPoseGraph(30);
+    registration::GlobalOptimizationConvergenceCriteria criteria;
+
+    registration::PoseGraph pose_graph_dense = pose_graph_init;
+    registration::GlobalOptimizationOption option_dense(0.075, 0.25, 1.0, 0,
+                                                        true);
+    registration::GlobalOptimization(pose_graph_dense, method, criteria,
+                                     option_dense);
+
+    registration::PoseGraph pose_graph_sparse = pose_graph_init;
+    registration::GlobalOptimizationOption option_sparse(0.075, 0.25, 1.0, 0,
+                                                         false);
+    registration::GlobalOptimization(pose_graph_sparse, method, criteria,
+                                     option_sparse);
+
+    // The optimization moved the nodes, and both solvers agree.
+    EXPECT_GT((Eigen::Matrix4d(pose_graph_init.nodes_.back().pose_) -
+               Eigen::Matrix4d(pose_graph_sparse.nodes_.back().pose_))
+                      .norm(),
+              1e-3);
+    EXPECT_EQ(pose_graph_dense.edges_.size(), pose_graph_sparse.edges_.size());
+    ExpectPoseGraphNodesEQ(pose_graph_dense, pose_graph_sparse, threshold);
+}
+
+/// Feeds \p pose_graph to an incremental optimizer one node at a time, with
+/// the edges that join it to the previous nodes.
+registration::PoseGraph OptimizeIncrementally(
+        const registration::PoseGraph &pose_graph,
+        const registration::GlobalOptimizationOption &option,
+        int window_size) {
+    registration::IncrementalPoseGraphOptimizer optimizer(
+            registration::GlobalOptimizationConvergenceCriteria(), option,
+            window_size);
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        int node_id = optimizer.AddNode(pose_graph.nodes_[i]);
+        EXPECT_EQ(node_id, int(i));
+        for (const auto &edge : pose_graph.edges_) {
+            if (std::max(edge.source_node_id_, edge.target_node_id_) ==
+                int(i)) {
+                optimizer.AddEdge(edge);
+            }
+        }
+        optimizer.Update();
+    }
+    return optimizer.GetPoseGraph();
+}
+
+}  // unnamed namespace
+
 TEST(GlobalOptimization, DISABLED_Constructor) { unit_test::NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    unit_test::NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    TestSparseMatchesDense(registration::GlobalOptimizationLevenbergMarquardt(),
+                           1e-6);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    // The Gauss-Newton system is singular without damping, so the two
+    // factorizations take slightly different steps along its null space.
+    TestSparseMatchesDense(registration::GlobalOptimizationGaussNewton(), 1e-3);
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -45,3 +166,61 @@ TEST(GlobalOptimization, DISABLED_GlobalOptimizationOption) {
 TEST(GlobalOptimization, DISABLED_CreatePoseGraphWithoutInvalidEdges) {
     unit_test::NotImplemented();
 }
+
+TEST(GlobalOptimization, IncrementalPoseGraphOptimizer) {
+    registration::PoseGraph pose_graph_init = CreateLoopPoseGraph(30);
+    registration::GlobalOptimizationOption option(0.075, 0.25, 1.0, 0, false);
+
+    registration::PoseGraph pose_graph_batch = pose_graph_init;
+    registration::GlobalOptimization(
+            pose_graph_batch, registration::GlobalOptimizationGaussNewton(),
+            registration::GlobalOptimizationConvergenceCriteria(), option);
+
+    // A window spanning the whole graph optimizes every node at every update.
+    registration::PoseGraph pose_graph_full =
+            OptimizeIncrementally(pose_graph_init, option, 30);
+    EXPECT_EQ(pose_graph_batch.edges_.size(), pose_graph_full.edges_.size());
+    ExpectPoseGraphNodesEQ(pose_graph_batch, pose_graph_full, 1e-3);
+
+    // The loop closure edges reach 5 nodes back, further than a window of 2
+    // edges, so they fall back to optimizing the whole graph.
+    registration::PoseGraph pose_graph_window =
+            OptimizeIncrementally(pose_graph_init, option, 2);
+    ExpectPoseGraphNodesEQ(pose_graph_batch, pose_graph_window, 1e-2);
+}
+
+TEST(GlobalOptimization, IncrementalPoseGraphOptimizerLoopClosure) {
+    registration::PoseGraph pose_graph_init = CreateLoopPoseGraph(30);
+    registration::GlobalOptimizationOption option(0.075, 0.25, 1.0, 0, false);
+    registration::IncrementalPoseGraphOptimizer optimizer(
+            registration::GlobalOptimizationConvergenceCriteria(), option, 2);
+
+    // Odometry only: nothing to correct, the chained poses stay put.
+    for (size_t i = 0; i < pose_graph_init.nodes_.size(); i++) {
+        optimizer.AddNode(pose_graph_init.nodes_[i]);
+        if (i > 0) optimizer.AddEdge(pose_graph_init.edges_[i - 1]);
+        optimizer.Update();
+    }
+    for (size_t i = 0; i < pose_graph_init.nodes_.size(); i++) {
+        unit_test::ExpectEQ(Eigen::Matrix4d(pose_graph_init.nodes_[i].pose_),
+                            Eigen::Matrix4d(optimizer.GetPose(int(i))), 1e-6);
+    }
+
+    // An edge from the last node back to the first closes the loop and moves
+    // the far end of the chain.
+    const auto &last = pose_graph_init.nodes_.back().pose_;
+    Eigen::Matrix4d closure = Eigen::Matrix4d::Identity();
+    closure.block<3, 1>(0, 3) = Eigen::Vector3d(0.0, 0.0, 0.5);
+    closure = closure * last.inverse() * pose_graph_init.nodes_[0].pose_;
+    optimizer.AddEdge(registration::PoseGraphEdge(
+            0, int(pose_graph_init.nodes_.size()) - 1, closure,
+            Eigen::Matrix6d::Identity() * 1000.0, false));
+    optimizer.Update();
+    unit_test::ExpectEQ(Eigen::Matrix4d(pose_graph_init.nodes_[0].pose_),
+                        Eigen::Matrix4d(optimizer.GetPose(0)));
+    EXPECT_GT((Eigen::Matrix4d(last) -
+               Eigen::Matrix4d(optimizer.GetPose(
+                       int(pose_graph_init.nodes_.size()) - 1)))
+                      .norm(),
+              0.1);
+}
@@ -24,8 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Registration, DISABLED_ICPConvergenceCriteria) {
     unit_test::NotImplemented();
 }
@@ -42,11 +52,152 @@ TEST(Registration, DISABLED_RANSACConvergenceCriteria) {
 
 TEST(Registration, DISABLED_RegistrationResult) { unit_test::NotImplemented(); }
 
-TEST(Registration, DISABLED_EvaluateRegistration) {
-    unit_test::NotImplemented();
+TEST(Registration, EvaluateRegistration) {
+    const int size = 1000;
+    geometry::PointCloud target;
+    target.points_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+    geometry::PointCloud source;
+    source.points_.resize(size);
+    unit_test::Rand(source.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 1);
+
+    const double max_distance = 0.05;
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, 0.02, 0.03);
+    registration::RegistrationResult result =
+            registration::EvaluateRegistration(source, target, max_distance,
+                                               transformation);
+
+    // Brute force nearest neighbors, in source order.
+    registration::CorrespondenceSet ref_correspondence_set;
+    double ref_error2 = 0.0;
+    for (int i = 0; i < size; i++) {
+        Eigen::Vector3d point =
+                source.points_[i] + transformation.block<3, 1>(0, 3);
+        int index = -1;
+        double dist2 = max_distance * max_distance;
+        for (int j = 0; j < size; j++) {
+            double d2 = (target.points_[j] - point).squaredNorm();
+            if (d2 < dist2) {
+                index = j;
+                dist2 = d2;
+            }
+        }
+        if (index >= 0) {
+            ref_correspondence_set.push_back(Eigen::Vector2i(i, index));
+            ref_error2 += dist2;
+        }
+    }
+
+    ASSERT_GT(ref_correspondence_set.size(), 0u);
+    unit_test::ExpectEQ(ref_correspondence_set, result.correspondence_set_);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation);
+    EXPECT_NEAR(result.fitness_,
+                double(ref_correspondence_set.size()) / double(size),
+                unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(result.inlier_rmse_,
+                std::sqrt(ref_error2 / ref_correspondence_set.size()),
+                unit_test::THRESHOLD_1E_6);
+}
+
+TEST(Registration, RegistrationICP) {
+    const int size = 1000;
+    geometry::PointCloud target;
+    target.points_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, -0.01, 0.005);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    registration::RegistrationResult result = registration::RegistrationICP(
+            source, target, 0.05, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPoint(false),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 100));
+
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation);
+    EXPECT_NEAR(result.fitness_, 1.0, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, unit_test::THRESHOLD_1E_6);
+    ASSERT_EQ(result.correspondence_set_.size(), size_t(size));
+    for (int i = 0; i < size; i++) {
+        EXPECT_EQ(result.correspondence_set_[i], Eigen::Vector2i(i, i));
+    }
+}
+
+TEST(Registration, PointCloudPyramid) {
+    geometry::PointCloud cloud;
+    cloud.points_.resize(1000);
+    unit_test::Rand(cloud.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+
+    registration::PointCloudPyramid pyramid(cloud, {0.2, 0.1, 0.0}, true);
+    ASSERT_EQ(pyramid.NumLevels(), 3u);
+    EXPECT_EQ(pyramid.GetVoxelSizes(), std::vector<double>({0.2, 0.1, 0.0}));
+    EXPECT_LT(pyramid.GetLevel(0).points_.size(),
+              pyramid.GetLevel(1).points_.size());
+    EXPECT_LT(pyramid.GetLevel(1).points_.size(),
+              pyramid.GetLevel(2).points_.size());
+    unit_test::ExpectEQ(pyramid.GetLevel(2).points_, cloud.points_);
+    for (size_t level = 0; level < pyramid.NumLevels(); level++) {
+        EXPECT_TRUE(pyramid.GetLevel(level).HasNormals());
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        EXPECT_EQ(pyramid.GetKDTree(level).SearchKNN(
+                          pyramid.GetLevel(level).points_[0], 1, indices,
+                          distance2),
+                  1);
+        EXPECT_EQ(indices[0], 0);
+    }
 }
 
-TEST(Registration, DISABLED_RegistrationICP) { unit_test::NotImplemented(); }
+TEST(Registration, RegistrationMultiScaleICP) {
+    const int size = 2000;
+    geometry::PointCloud target;
+    target.points_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.1, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.05, -0.03, 0.02);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    const std::vector<double> voxel_sizes = {0.1, 0.05, 0.0};
+    const std::vector<double> max_distances = {0.3, 0.15, 0.05};
+    registration::PointCloudPyramid target_pyramid(target, voxel_sizes);
+    registration::RegistrationResult result =
+            registration::RegistrationMultiScaleICP(source, target_pyramid,
+                                                    max_distances);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation);
+    EXPECT_NEAR(result.fitness_, 1.0, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, unit_test::THRESHOLD_1E_6);
+
+    // Registering against the same pyramid again gives the same result, and
+    // so does building the pyramid on the fly.
+    registration::RegistrationResult result_again =
+            registration::RegistrationMultiScaleICP(source, target_pyramid,
+                                                    max_distances);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result_again.transformation_),
+                        Eigen::Matrix4d(result.transformation_));
+    registration::RegistrationResult result_target =
+            registration::RegistrationMultiScaleICP(source, target, voxel_sizes,
+                                                    max_distances);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result_target.transformation_),
+                        Eigen::Matrix4d(result.transformation_));
+}
 
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     unit_test::NotImplemented();
@@ -56,8 +207,53 @@ TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
     unit_test::NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
-    unit_test::NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatching) {
+    const int size = 500;
+    geometry::PointCloud target;
+    target.points_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    // Source point i matches target point i, except for a third of the points
+    // whose features are shuffled into wrong matches.
+    registration::Feature target_feature;
+    target_feature.data_ = Eigen::MatrixXd::Random(8, size);
+    registration::Feature source_feature = target_feature;
+    for (int i = 0; i < size / 6; i++) {
+        source_feature.data_.col(i).swap(
+                source_feature.data_.col(i + size / 6));
+    }
+
+    registration::CorrespondenceCheckerBasedOnEdgeLength checker_edge(0.9);
+    registration::CorrespondenceCheckerBasedOnDistance checker_distance(0.01);
+    registration::RegistrationResult result =
+            registration::RegistrationRANSACBasedOnFeatureMatching(
+                    source, target, source_feature, target_feature, 0.01,
+                    registration::TransformationEstimationPointToPoint(false),
+                    3, {checker_edge, checker_distance},
+                    registration::RANSACConvergenceCriteria(100000, 100));
+
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation);
+    EXPECT_NEAR(result.fitness_, 1.0, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, unit_test::THRESHOLD_1E_6);
+    EXPECT_EQ(result.correspondence_set_.size(), size_t(size));
+
+    // Without any hypothesis to validate, the result is empty.
+    result = registration::RegistrationRANSACBasedOnFeatureMatching(
+            source, target, source_feature, target_feature, 0.01,
+            registration::TransformationEstimationPointToPoint(false), 3, {},
+            registration::RANSACConvergenceCriteria(100000, 0));
+    EXPECT_EQ(result.fitness_, 0.0);
+    EXPECT_TRUE(result.correspondence_set_.empty());
 }
 
 TEST(Registration, DISABLED_GetInformationMatrixFromPointClouds) {
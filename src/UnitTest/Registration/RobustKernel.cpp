@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RobustKernel.h"
+
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+TEST(RobustKernel, L2Loss) {
+    registration::L2Loss kernel;
+    EXPECT_EQ(kernel.Weight(0.0), 1.0);
+    EXPECT_EQ(kernel.Weight(-3.0), 1.0);
+    EXPECT_EQ(kernel.Weight(100.0), 1.0);
+}
+
+TEST(RobustKernel, HuberLoss) {
+    registration::HuberLoss kernel(0.5);
+    EXPECT_EQ(kernel.Weight(0.0), 1.0);
+    EXPECT_EQ(kernel.Weight(-0.5), 1.0);
+    EXPECT_NEAR(kernel.Weight(2.0), 0.25, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(kernel.Weight(-2.0), 0.25, unit_test::THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, CauchyLoss) {
+    registration::CauchyLoss kernel(0.5);
+    EXPECT_EQ(kernel.Weight(0.0), 1.0);
+    EXPECT_NEAR(kernel.Weight(0.5), 0.5, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(kernel.Weight(-1.5), 0.1, unit_test::THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, TukeyLoss) {
+    registration::TukeyLoss kernel(0.5);
+    EXPECT_EQ(kernel.Weight(0.0), 1.0);
+    EXPECT_NEAR(kernel.Weight(0.25), 0.5625, unit_test::THRESHOLD_1E_6);
+    EXPECT_NEAR(kernel.Weight(-0.25), 0.5625, unit_test::THRESHOLD_1E_6);
+    EXPECT_EQ(kernel.Weight(0.5), 0.0);
+    EXPECT_EQ(kernel.Weight(2.0), 0.0);
+}
@@ -24,8 +24,66 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/TransformationEstimation.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// Random points with random normals, and the source moved away from them by
+/// the inverse of \p transformation. Source point i corresponds to target
+/// point i, the last \p num_outliers source points are first pushed off the
+/// surface by 0.5 along their normal.
+void CreateCorrespondingPointClouds(int size,
+                                    int num_outliers,
+                                    const Eigen::Matrix4d &transformation,
+                                    geometry::PointCloud &source,
+                                    geometry::PointCloud &target,
+                                    registration::CorrespondenceSet &corres) {
+    target.points_.resize(size);
+    target.normals_.resize(size);
+    unit_test::Rand(target.points_, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Ones(), 0);
+    unit_test::Rand(target.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d::Ones(), 1);
+    target.NormalizeNormals();
+    source = target;
+    for (int i = size - num_outliers; i < size; i++) {
+        source.points_[i] += 0.5 * source.normals_[i];
+    }
+    source.Transform(transformation.inverse());
+
+    corres.resize(size);
+    for (int i = 0; i < size; i++) {
+        corres[i] = Eigen::Vector2i(i, i);
+    }
+}
+
+/// Runs \p iterations Gauss-Newton steps of \p estimation on fixed
+/// correspondences and returns the accumulated transformation.
+Eigen::Matrix4d EstimateTransformation(
+        const registration::TransformationEstimation &estimation,
+        geometry::PointCloud source,
+        const geometry::PointCloud &target,
+        const registration::CorrespondenceSet &corres,
+        int iterations) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    for (int i = 0; i < iterations; i++) {
+        Eigen::Matrix4d update =
+                estimation.ComputeTransformation(source, target, corres);
+        source.Transform(update);
+        transformation = update * transformation;
+    }
+    return transformation;
+}
+
+}  // unnamed namespace
+
 TEST(TransformationEstimation, DISABLED_Constructor) {
     unit_test::NotImplemented();
 }
@@ -54,6 +112,70 @@ TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPoint) {
     unit_test::NotImplemented();
 }
 
-TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPlane) {
-    unit_test::NotImplemented();
+TEST(TransformationEstimation, TransformationEstimationPointToPlane) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.1, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.03, -0.02, 0.01);
+    geometry::PointCloud source, target;
+    registration::CorrespondenceSet corres;
+    CreateCorrespondingPointClouds(1000, 0, transformation, source, target,
+                                   corres);
+
+    registration::TransformationEstimationPointToPlane estimation;
+    unit_test::ExpectEQ(
+            EstimateTransformation(estimation, source, target, corres, 10),
+            transformation);
+    EXPECT_GT(estimation.ComputeRMSE(source, target, corres), 1e-3);
+
+    // A null kernel is the L2Loss.
+    registration::TransformationEstimationPointToPlane null_estimation(
+            nullptr);
+    unit_test::ExpectEQ(EstimateTransformation(null_estimation, source,
+                                               target, corres, 10),
+                        transformation);
+    registration::TransformationEstimationPointToPlane reset_estimation;
+    reset_estimation.kernel_ = nullptr;
+    unit_test::ExpectEQ(EstimateTransformation(reset_estimation, source,
+                                               target, corres, 10),
+                        transformation);
+
+    // Every kernel has the same minimum without outliers.
+    for (const auto &kernel :
+         std::vector<std::shared_ptr<registration::RobustKernel>>{
+                 std::make_shared<registration::HuberLoss>(0.01),
+                 std::make_shared<registration::CauchyLoss>(0.01),
+                 std::make_shared<registration::TukeyLoss>(0.5)}) {
+        registration::TransformationEstimationPointToPlane robust_estimation(
+                kernel);
+        unit_test::ExpectEQ(EstimateTransformation(robust_estimation, source,
+                                                   target, corres, 20),
+                            transformation);
+    }
+}
+
+TEST(TransformationEstimation, TransformationEstimationPointToPlaneOutliers) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.1, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.03, -0.02, 0.01);
+    geometry::PointCloud source, target;
+    registration::CorrespondenceSet corres;
+    CreateCorrespondingPointClouds(1000, 200, transformation, source, target,
+                                   corres);
+
+    // Least squares is pulled away by the outliers, Tukey's biweight ignores
+    // them once the inliers are aligned.
+    registration::TransformationEstimationPointToPlane estimation;
+    EXPECT_GT((EstimateTransformation(estimation, source, target, corres, 20) -
+               transformation)
+                      .norm(),
+              1e-2);
+    registration::TransformationEstimationPointToPlane robust_estimation(
+            std::make_shared<registration::TukeyLoss>(0.2));
+    unit_test::ExpectEQ(EstimateTransformation(robust_estimation, source,
+                                               target, corres, 20),
+                        transformation);
 }
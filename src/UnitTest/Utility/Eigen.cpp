@@ -257,3 +257,83 @@ TEST(Eigen, ComputeJTJandJTr_vector) {
     ExpectEQ(ref_JTr, JTr);
     ExpectEQ(ref_JTJ, JTJ);
 }
+
+TEST(Eigen, ComputeFusedJTJandJTr) {
+    Matrix6d ref_JTJ;
+    ref_JTJ << 2.819131, 0.023929, -0.403568, 1.276125, 0.437555, -1.123875,
+            0.023929, 2.817778, 0.086121, 1.133195, -0.124291, -0.695210,
+            -0.403568, 0.086121, 3.435509, -0.094671, 0.466959, -0.215179,
+            1.276125, 1.133195, -0.094671, 3.826990, -0.235632, -0.917586,
+            0.437555, -0.124291, 0.466959, -0.235632, 2.802768, -0.496025,
+            -1.123875, -0.695210, -0.215179, -0.917586, -0.496025, 2.951511;
+
+    Vector6d ref_JTr;
+    ref_JTr << 0.477778, -0.262092, -0.162745, -0.545752, -0.643791, -0.883007;
+
+    auto testFunction = [&](int i, Vector6d *J_r, double *r) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            vector<double> v(6);
+            Rand(v, -1.0, 1.0, i);
+
+            for (int k = 0; k < 6; k++) J_r[0](k) = v[k];
+
+            r[0] = (double)(i % 6) / 6;
+        }
+    };
+
+    int iteration_num = 10;
+
+    Matrix6d JTJ = Matrix6d::Zero();
+    Vector6d JTr = Vector6d::Zero();
+    double r = 0.0;
+
+    tie(JTJ, JTr, r) =
+            utility::ComputeFusedJTJandJTr(testFunction, iteration_num);
+
+    ExpectEQ(ref_JTr, JTr);
+    ExpectEQ(ref_JTJ, JTJ);
+}
+
+TEST(Eigen, ComputeFusedJTJandJTr_vector) {
+    Matrix6d ref_JTJ;
+    ref_JTJ << 28.191311, 0.239293, -4.035679, 12.761246, 4.375548, -11.238754,
+            0.239293, 28.177778, 0.861207, 11.331949, -1.242907, -6.952095,
+            -4.035679, 0.861207, 34.355094, -0.946713, 4.669589, -2.151788,
+            12.761246, 11.331949, -0.946713, 38.269896, -2.356324, -9.175855,
+            4.375548, -1.242907, 4.669589, -2.356324, 28.027682, -4.960246,
+            -11.238754, -6.952095, -2.151788, -9.175855, -4.960246, 29.515110;
+
+    Vector6d ref_JTr;
+    ref_JTr << 2.896078, 4.166667, -1.629412, 1.386275, -4.468627, -7.115686;
+
+    auto testFunction = [&](int i, Vector6d *J_r, double *r) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            vector<double> v(6);
+            for (int s = 0; s < 10; s++) {
+                Rand(v, -1.0, 1.0, i);
+
+                for (int k = 0; k < 6; k++) J_r[s](k) = v[k];
+
+                r[s] = (double)((i * s) % 6) / 6;
+            }
+        }
+    };
+
+    int iteration_num = 10;
+
+    Matrix6d JTJ = Matrix6d::Zero();
+    Vector6d JTr = Vector6d::Zero();
+    double r = 0.0;
+
+    tie(JTJ, JTr, r) =
+            utility::ComputeFusedJTJandJTr<10>(testFunction, iteration_num);
+
+    ExpectEQ(ref_JTr, JTr);
+    ExpectEQ(ref_JTJ, JTJ);
+}